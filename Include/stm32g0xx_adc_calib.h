@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_adc_calib.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx ADC calibrated conversions header file.
+  *
+  *          Raw ADC codes to millivolts and degrees Celsius from the
+  *          factory calibration words, in fixed point and without any
+  *          division after initialization (the Cortex-M0+ has no divide
+  *          instruction):
+  *           - VREFINT_CAL, the internal reference read at VDDA = 3.0 V,
+  *             and TS_CAL1, the temperature sensor read at 30 degC and
+  *             VDDA = 3.0 V, are taken from system memory next to UID_BASE
+  *           - the constant part of every scale factor is computed once
+  *             by ADCCAL_Init()
+  *           - each VREFINT reading gives VDDA through a Newton-Raphson
+  *             reciprocal, made of multiplications only, and refreshes the
+  *             per-code factors
+  *           - a conversion is then one multiplication and one shift
+  *
+  *          Results with more than 12 bits, e.g. oversampled without a
+  *          full shift, are supported: the calibration words are scaled to
+  *          the result width.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_adc_calib
+  * @{
+  */
+
+#ifndef STM32G0XX_ADC_CALIB_H
+#define STM32G0XX_ADC_CALIB_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_ADC_Calib_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Calib_Exported_Constants
+  * @{
+  */
+
+/** @defgroup ADC_Calib_Factory Factory calibration data
+  * @{
+  */
+#define ADCCAL_TS_CAL1_ADDR            ((const uint16_t *)(UID_BASE + 0x18UL)) /*!< TS_CAL1, 0x1FFF75A8     */
+#define ADCCAL_VREFINT_CAL_ADDR        ((const uint16_t *)(UID_BASE + 0x1AUL)) /*!< VREFINT_CAL, 0x1FFF75AA */
+#define ADCCAL_CAL_VDDA_MV             (3000UL)                            /*!< VDDA of both words      */
+#define ADCCAL_TS_CAL1_CENTIDEG        (3000L)                             /*!< TS_CAL1 temperature     */
+#define ADCCAL_AVG_SLOPE_UV            (2500UL)                            /*!< Typical sensor slope,
+                                                                                in uV per degC          */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Calib_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Calibrated conversion handle.
+  */
+typedef struct
+{
+  uint32_t ResultBits;                   /*!< Result width, 12 to 16           */
+  uint32_t VrefintCal;                   /*!< 12-bit VREFINT_CAL, 0 to read the
+                                              factory word                     */
+  uint32_t TsCal1;                       /*!< 12-bit TS_CAL1, 0 to read the
+                                              factory word                     */
+  uint32_t AvgSlope;                     /*!< Sensor slope in uV per degC, 0
+                                              for ADCCAL_AVG_SLOPE_UV          */
+
+  uint32_t VrefNum;                      /*!< VDDA times the VREFINT code
+                                              (internal)                       */
+  uint32_t CodeNum;                      /*!< MvPerCode times the VREFINT code
+                                              (internal)                       */
+  uint32_t InvSlope;                     /*!< Centidegrees per mV, Q12
+                                              (internal)                       */
+  uint32_t TsBias;                       /*!< TS_CAL1 offset, Q12 (internal)   */
+  uint32_t Vdda;                         /*!< VDDA in mV                       */
+  uint32_t MvPerCode;                    /*!< mV per code, Q16 at 12 bits, one
+                                              more bit per extra result bit
+                                              (internal)                       */
+  uint32_t TsScale;                      /*!< Centidegrees per code, Q12
+                                              (internal)                       */
+} ADCCAL_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Calib_Exported_Functions
+  * @{
+  */
+
+ErrorStatus ADCCAL_Init(ADCCAL_HandleTypeDef *hcal);
+uint32_t    ADCCAL_SetVrefint(ADCCAL_HandleTypeDef *hcal, uint32_t Raw);
+uint32_t    ADCCAL_ToMillivolts(const ADCCAL_HandleTypeDef *hcal, uint32_t Raw);
+int32_t     ADCCAL_ToCentidegrees(const ADCCAL_HandleTypeDef *hcal, uint32_t Raw);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_ADC_CALIB_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
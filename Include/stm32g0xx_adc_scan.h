@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_adc_scan.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx ADC continuous scan pipeline header file.
+  *
+  *          A channel set sampled without CPU involvement per conversion:
+  *           - ADC_CHSELR selects the channels, scanned in ascending order;
+  *             ADC_CFGR1 CONT restarts the sequence as soon as it ends
+  *           - ADC_CFGR2 OVSE averages 2 to 256 conversions per channel in
+  *             hardware, so one DMA transfer carries one oversampled result
+  *           - ADC_CFGR1 DMACFG keeps the DMA requests going in circular
+  *             mode; the buffer holds two halves of whole frames, one frame
+  *             being one result per selected channel
+  *           - each half is handed to a callback from the DMA half and full
+  *             events while the other one fills
+  *
+  *          An overrun stops the DMA requests; the pipeline then restarts
+  *          the scan at the first channel, so frames stay aligned.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_adc_scan
+  * @{
+  */
+
+#ifndef STM32G0XX_ADC_SCAN_H
+#define STM32G0XX_ADC_SCAN_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_ADC_Scan_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Exported_Constants
+  * @{
+  */
+
+/** @defgroup ADC_Scan_Oversampling Oversampling ratio, ADC_CFGR2 OVSR values
+  * @{
+  */
+#define ADCSCAN_OVS_NONE               (0xFFFFFFFFUL)                      /*!< No oversampling */
+#define ADCSCAN_OVS_2                  (0UL)                               /*!< 2 conversions   */
+#define ADCSCAN_OVS_4                  (1UL)                               /*!< 4 conversions   */
+#define ADCSCAN_OVS_8                  (2UL)                               /*!< 8 conversions   */
+#define ADCSCAN_OVS_16                 (3UL)                               /*!< 16 conversions  */
+#define ADCSCAN_OVS_32                 (4UL)                               /*!< 32 conversions  */
+#define ADCSCAN_OVS_64                 (5UL)                               /*!< 64 conversions  */
+#define ADCSCAN_OVS_128                (6UL)                               /*!< 128 conversions */
+#define ADCSCAN_OVS_256                (7UL)                               /*!< 256 conversions */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Exported_Types
+  * @{
+  */
+
+typedef struct ADCSCAN_Handle ADCSCAN_HandleTypeDef;
+
+/**
+  * @brief Frame callback, runs in the DMA interrupt.
+  * @note  Frames holds NbFrames frames of one result per selected channel,
+  *        lowest channel first; it is overwritten once the next half fills.
+  */
+typedef void (*ADCSCAN_CallbackTypeDef)(ADCSCAN_HandleTypeDef *hscan, const uint16_t *Frames, uint32_t NbFrames);
+
+/**
+  * @brief Pipeline statistics.
+  */
+typedef struct
+{
+  uint32_t Halves;                       /*!< Halves handed to the callback    */
+  uint32_t Frames;                       /*!< Frames handed to the callback    */
+  uint32_t Late;                         /*!< Callbacks that ended after the
+                                              DMA had moved on to their half   */
+  uint32_t Overruns;                     /*!< Overruns, scan restarted         */
+  uint32_t DmaErrors;                    /*!< DMA transfer errors              */
+  uint32_t LastCycles;                   /*!< Last callback duration, cycles   */
+  uint32_t MaxCycles;                    /*!< Longest callback, cycles         */
+  uint64_t TotalCycles;                  /*!< Callback cycles, summed          */
+} ADCSCAN_StatsTypeDef;
+
+/**
+  * @brief Throughput report, over the time since the statistics were reset.
+  */
+typedef struct
+{
+  uint32_t SampleRate;                   /*!< Results per second, expected
+                                              from the ADC clock               */
+  uint32_t SustainedRate;                /*!< Results per second delivered to
+                                              the callback                     */
+  uint32_t FrameRate;                    /*!< Frames per second delivered to
+                                              the callback                     */
+  uint32_t LoadPpm;                      /*!< CPU time in the callback         */
+} ADCSCAN_ReportTypeDef;
+
+/**
+  * @brief Scan pipeline handle.
+  */
+struct ADCSCAN_Handle
+{
+  ADC_TypeDef *Instance;                 /*!< ADC1, clock enabled and ADC clock
+                                              mode set by the application      */
+  uint32_t Channels;                     /*!< ADC_CHSELR_CHSELx bit mask       */
+  uint32_t SamplingTime;                 /*!< ADC_SMPR SMP1 value, 0 to 7      */
+  uint32_t Oversampling;                 /*!< ADCSCAN_OVS_xx                   */
+  uint32_t Shift;                        /*!< Result right shift, OVSS 0 to 8  */
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel                      */
+  uint32_t Priority;                     /*!< DMA_CCR_PL value                 */
+  uint16_t *Buffer;                      /*!< 2 * FramesPerHalf frames         */
+  uint32_t FramesPerHalf;                /*!< Frames per callback              */
+  ADCSCAN_CallbackTypeDef Callback;      /*!< Frame consumer                   */
+
+  uint32_t NbChannels;                   /*!< Results per frame (internal)     */
+  uint32_t HalfSamples;                  /*!< Results per half (internal)      */
+  ADCSCAN_StatsTypeDef Stats;            /*!< Statistics                       */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Exported_Functions
+  * @{
+  */
+
+uint32_t    ADCSCAN_GetAdcClock(const ADC_TypeDef *Instance);
+ErrorStatus ADCSCAN_Init(ADCSCAN_HandleTypeDef *hscan);
+void        ADCSCAN_Start(ADCSCAN_HandleTypeDef *hscan);
+void        ADCSCAN_Stop(ADCSCAN_HandleTypeDef *hscan);
+uint32_t    ADCSCAN_GetSampleRate(const ADCSCAN_HandleTypeDef *hscan);
+void        ADCSCAN_ADC_IRQHandler(ADCSCAN_HandleTypeDef *hscan);
+void        ADCSCAN_DMA_IRQHandler(ADCSCAN_HandleTypeDef *hscan);
+void        ADCSCAN_FlagsHandler(void *Context, uint32_t Flags);
+ErrorStatus ADCSCAN_GetReport(const ADCSCAN_HandleTypeDef *hscan, uint32_t ElapsedMs, ADCSCAN_ReportTypeDef *Report);
+void        ADCSCAN_ResetStats(ADCSCAN_HandleTypeDef *hscan);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_ADC_SCAN_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_adc_watch.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx ADC analog watchdog event capture header file.
+  *
+  *          Threshold crossings detected by the ADC instead of by polling,
+  *          with the waveform around each one:
+  *           - the ADC scans continuously into a circular DMA ring through
+  *             the ADC scan pipeline; the ring is the pre-trigger buffer
+  *           - the three analog watchdogs compare every result with a
+  *             window: ADC_TR1 for AWD1 on one or all channels, ADC_TR2 /
+  *             ADC_TR3 for the channel sets of ADC_AWD2CR / ADC_AWD3CR
+  *           - the ADC interrupts only when a result leaves its window; the
+  *             watchdog interrupts are then masked, the trigger frame is
+  *             located from the DMA counter and, once the post-trigger
+  *             frames are in, the window around it is copied out and handed
+  *             to a callback
+  *           - the watchdogs are re-armed automatically or by the
+  *             application
+  *
+  *          The trigger frame is the last one moved when the ADC interrupt
+  *          runs: at high sample rates the interrupt latency can move it
+  *          several frames past the crossing, and Event.Channels can then
+  *          be 0. Lower the rate, or raise PreFrames and look back in the
+  *          captured frames.
+  *
+  *          A window as long as a half of the ring leaves almost no time to
+  *          copy it out when it ends just after a half boundary; such events
+  *          are flagged Overwritten.
+  *
+  *          In steady state the CPU only takes the DMA half and full
+  *          interrupts of the ring, which return at once; a longer ring
+  *          makes them rarer.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_adc_watch
+  * @{
+  */
+
+#ifndef STM32G0XX_ADC_WATCH_H
+#define STM32G0XX_ADC_WATCH_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_ADC_Watch_Includes
+  * @{
+  */
+#include "stm32g0xx_adc_scan.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Exported_Constants
+  * @{
+  */
+
+#define ADCWATCH_NB_WATCHDOGS          (3UL)
+
+/** @defgroup ADC_Watch_Watchdog Watchdog bits, as in ADC_ISR and ADC_IER
+  * @{
+  */
+#define ADCWATCH_AWD1                  (ADC_ISR_AWD1)                      /*!< Analog watchdog 1 */
+#define ADCWATCH_AWD2                  (ADC_ISR_AWD2)                      /*!< Analog watchdog 2 */
+#define ADCWATCH_AWD3                  (ADC_ISR_AWD3)                      /*!< Analog watchdog 3 */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Exported_Types
+  * @{
+  */
+
+typedef struct ADCWATCH_Handle ADCWATCH_HandleTypeDef;
+
+/**
+  * @brief Watchdog window.
+  * @note  Thresholds are 12-bit codes. With oversampling, the results must
+  *        be shifted back to 12 bits for the window to apply to them.
+  */
+typedef struct
+{
+  uint32_t Channels;                     /*!< ADC_CHSELR_CHSELx bit mask, 0 to
+                                              leave the watchdog off; AWD1
+                                              takes one channel or the whole
+                                              scanned set                      */
+  uint16_t Low;                          /*!< Lowest code in the window        */
+  uint16_t High;                         /*!< Highest code in the window       */
+} ADCWATCH_WindowTypeDef;
+
+/**
+  * @brief Captured event.
+  */
+typedef struct
+{
+  uint32_t Watchdogs;                    /*!< ADCWATCH_AWDx that fired         */
+  uint32_t Channels;                     /*!< Channels outside their window in
+                                              the trigger frame, ADC_CHSELR
+                                              bits; may be 0, see above        */
+  const uint16_t *Frames;                /*!< NbFrames frames, oldest first    */
+  uint32_t NbFrames;                     /*!< PreFrames + 1 + PostFrames       */
+  uint32_t Trigger;                      /*!< Index of the trigger frame       */
+  uint32_t Overwritten;                  /*!< 1 when the DMA reached the oldest
+                                              frames before they were copied:
+                                              they are corrupted               */
+} ADCWATCH_EventTypeDef;
+
+/**
+  * @brief Event callback, runs in the DMA interrupt.
+  */
+typedef void (*ADCWATCH_CallbackTypeDef)(ADCWATCH_HandleTypeDef *hwatch, const ADCWATCH_EventTypeDef *Event);
+
+/**
+  * @brief Event statistics.
+  */
+typedef struct
+{
+  uint32_t Events;                       /*!< Watchdog interrupts taken        */
+  uint32_t Captures;                     /*!< Events handed to the callback    */
+  uint32_t Aborted;                      /*!< Captures lost to an overrun      */
+  uint32_t Overwritten;                  /*!< Captures the DMA reached before
+                                              the copy was done                */
+} ADCWATCH_StatsTypeDef;
+
+/**
+  * @brief Event capture handle.
+  */
+struct ADCWATCH_Handle
+{
+  ADCSCAN_HandleTypeDef Scan;            /*!< Scan pipeline, Callback excluded;
+                                              must stay the first member       */
+  ADCWATCH_WindowTypeDef Window[ADCWATCH_NB_WATCHDOGS];  /*!< AWD1 to AWD3    */
+  uint32_t PreFrames;                    /*!< Frames kept before the trigger   */
+  uint32_t PostFrames;                   /*!< Frames kept after the trigger;
+                                              PreFrames + 1 + PostFrames must
+                                              not exceed Scan.FramesPerHalf    */
+  uint16_t *Capture;                     /*!< PreFrames + 1 + PostFrames
+                                              frames                           */
+  uint32_t AutoRearm;                    /*!< 1 to re-arm after each capture   */
+  ADCWATCH_CallbackTypeDef Callback;     /*!< Event consumer                   */
+
+  uint32_t Armed;                        /*!< Watchdog IE bits (internal)      */
+  volatile uint32_t Pending;             /*!< Capture in progress (internal)   */
+  uint32_t Fired;                        /*!< Watchdogs of it (internal)       */
+  uint32_t TriggerFrame;                 /*!< Ring frame index (internal)      */
+  uint32_t LastPosition;                 /*!< Ring position (internal)         */
+  uint32_t Remaining;                    /*!< Results still to come (internal) */
+  ADCWATCH_StatsTypeDef Stats;           /*!< Statistics                       */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Exported_Functions
+  * @{
+  */
+
+ErrorStatus ADCWATCH_Init(ADCWATCH_HandleTypeDef *hwatch);
+void        ADCWATCH_Start(ADCWATCH_HandleTypeDef *hwatch);
+void        ADCWATCH_Stop(ADCWATCH_HandleTypeDef *hwatch);
+void        ADCWATCH_Rearm(ADCWATCH_HandleTypeDef *hwatch);
+void        ADCWATCH_ADC_IRQHandler(ADCWATCH_HandleTypeDef *hwatch);
+void        ADCWATCH_ResetStats(ADCWATCH_HandleTypeDef *hwatch);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_ADC_WATCH_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
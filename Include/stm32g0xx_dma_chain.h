@@ -0,0 +1,172 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_chain.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMA descriptor chain engine header file.
+  *
+  *          The STM32G0 DMA channels transfer one linear block per activation.
+  *          This component emulates scatter-gather by walking a linked list of
+  *          descriptors: each time a segment completes, the next descriptor is
+  *          loaded into CMAR/CPAR/CNDTR from the transfer complete interrupt.
+  *
+  *          Segments may be started either directly by the peripheral request
+  *          or paced by a DMAMUX1 request generator. In the latter case the
+  *          next segment is armed from the transfer complete interrupt and
+  *          waits for the next generator trigger, so the reload latency is
+  *          hidden behind the trigger period.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_chain
+  * @{
+  */
+
+#ifndef STM32G0XX_DMA_CHAIN_H
+#define STM32G0XX_DMA_CHAIN_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_DMA_Chain_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Chain_Exported_Constants
+  * @{
+  */
+
+/* Descriptor flags */
+#define DMACHAIN_DESC_NOTIFY      (0x0001U) /*!< Call SegmentCallback when this segment completes */
+
+/* Trigger modes */
+#define DMACHAIN_TRIGGER_REQUEST  (0UL)     /*!< Segments run on the peripheral request           */
+#define DMACHAIN_TRIGGER_REQGEN   (1UL)     /*!< Segments are paced by a DMAMUX1 request generator */
+
+/* Engine states */
+#define DMACHAIN_STATE_IDLE       (0UL)     /*!< No chain in progress                             */
+#define DMACHAIN_STATE_BUSY       (1UL)     /*!< A chain is being transferred                     */
+#define DMACHAIN_STATE_ERROR      (2UL)     /*!< Stopped on a transfer error                      */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Chain_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Chain descriptor, one per linear segment.
+  * @note  Descriptors are only read by the engine and may live in flash.
+  *        A chain ends on a NULL Next pointer; pointing Next back to an
+  *        earlier descriptor builds an endless ring.
+  */
+typedef struct DMACHAIN_Desc
+{
+  uint32_t MemAddress;                   /*!< Loaded into CMAR                                   */
+  uint32_t PeriphAddress;                /*!< Loaded into CPAR, 0 keeps the previous value       */
+  uint16_t Length;                       /*!< Loaded into CNDTR, in data units (1..65535)         */
+  uint16_t Flags;                        /*!< Combination of DMACHAIN_DESC_xx                    */
+  const struct DMACHAIN_Desc *Next;      /*!< Next segment, NULL ends the chain                  */
+} DMACHAIN_DescTypeDef;
+
+/**
+  * @brief Engine statistics, updated from interrupt context.
+  * @note  Reload cycles are sampled from SysTick->VAL and are only valid when
+  *        SysTick is running from HCLK; they measure the time from the
+  *        interrupt handler entry until the next segment is enabled, which is
+  *        the software part of the inter-segment gap.
+  */
+typedef struct
+{
+  uint32_t Segments;                     /*!< Completed segments                                 */
+  uint32_t Chains;                       /*!< Completed chains                                   */
+  uint32_t Units;                        /*!< Transferred data units                             */
+  uint32_t Errors;                       /*!< Transfer errors                                    */
+  uint32_t LastReloadCycles;             /*!< Software reload cost of the last segment switch    */
+  uint32_t MaxReloadCycles;              /*!< Worst software reload cost                         */
+} DMACHAIN_StatsTypeDef;
+
+typedef struct DMACHAIN_Handle DMACHAIN_HandleTypeDef;
+
+typedef void (*DMACHAIN_SegmentCallbackTypeDef)(DMACHAIN_HandleTypeDef *hchain, const DMACHAIN_DescTypeDef *Desc);
+typedef void (*DMACHAIN_CallbackTypeDef)(DMACHAIN_HandleTypeDef *hchain);
+
+/**
+  * @brief Chain engine handle.
+  */
+struct DMACHAIN_Handle
+{
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel used by the engine                     */
+  uint32_t Config;                       /*!< CCR value: DIR, PINC, MINC, PSIZE, MSIZE, PL,
+                                              MEM2MEM. EN and interrupt enables are managed
+                                              by the engine                                      */
+  uint32_t Request;                      /*!< DMAMUX request ID (DMAMUX_CxCR_DMAREQ_ID value)    */
+  uint32_t Trigger;                      /*!< DMACHAIN_TRIGGER_xx                                */
+  uint32_t ReqGenConfig;                 /*!< DMAMUX_RGxCR value (SIG_ID, GPOL, GNBREQ) used in
+                                              DMACHAIN_TRIGGER_REQGEN mode, GE is managed by
+                                              the engine                                         */
+  DMACHAIN_SegmentCallbackTypeDef SegmentCallback;  /*!< Called for DMACHAIN_DESC_NOTIFY segments */
+  DMACHAIN_CallbackTypeDef CompleteCallback;        /*!< Called when the chain ends              */
+  DMACHAIN_CallbackTypeDef ErrorCallback;           /*!< Called on a transfer error              */
+
+  const DMACHAIN_DescTypeDef * volatile Active;     /*!< Segment being transferred (internal)    */
+  volatile uint32_t State;                          /*!< DMACHAIN_STATE_xx                       */
+  uint32_t CCRValue;                                /*!< Precomputed CCR without EN (internal)   */
+  DMACHAIN_StatsTypeDef Stats;                      /*!< Statistics                              */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Chain_Exported_Functions
+  * @{
+  */
+
+ErrorStatus DMACHAIN_Init(DMACHAIN_HandleTypeDef *hchain);
+ErrorStatus DMACHAIN_Start(DMACHAIN_HandleTypeDef *hchain, const DMACHAIN_DescTypeDef *Head);
+void        DMACHAIN_Stop(DMACHAIN_HandleTypeDef *hchain);
+void        DMACHAIN_IRQHandler(DMACHAIN_HandleTypeDef *hchain);
+void        DMACHAIN_FlagsHandler(void *Context, uint32_t Flags);
+void        DMACHAIN_ResetStats(DMACHAIN_HandleTypeDef *hchain);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_DMA_CHAIN_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
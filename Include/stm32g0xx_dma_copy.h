@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_copy.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMA accelerated memcpy/memset header file.
+  *
+  *          Memory to memory copies and fills are offloaded to a free DMA
+  *          channel so that they run concurrently with the CPU. Requests
+  *          smaller than a cutover size are served by the CPU, as the DMA
+  *          setup and completion interrupt would cost more than the copy.
+  *
+  *          The transfer width is selected from the alignment of both
+  *          addresses and of the size: word, then half-word, then byte.
+  *          Blocks longer than 65535 data units are split and resumed from
+  *          the transfer complete interrupt.
+  *
+  *          The default cutover sizes are estimates. DMACOPY_Benchmark()
+  *          times both paths on the target for one size at each transfer
+  *          width; running it over the sizes of interest, at each clock
+  *          configuration in use, gives the values to set.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_copy
+  * @{
+  */
+
+#ifndef STM32G0XX_DMA_COPY_H
+#define STM32G0XX_DMA_COPY_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_DMA_Copy_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Copy_Exported_Constants
+  * @{
+  */
+
+/*!< Default size, in bytes, below which word aligned requests use the CPU */
+#if !defined (DMACOPY_CUTOVER_DEFAULT)
+#define DMACOPY_CUTOVER_DEFAULT        (256UL)
+#endif /* DMACOPY_CUTOVER_DEFAULT */
+
+/*!< Cutover multiplier applied to half-word and byte transfers, which move
+     less data per bus access than the CPU copy loop */
+#if !defined (DMACOPY_CUTOVER_HALFWORD_MUL)
+#define DMACOPY_CUTOVER_HALFWORD_MUL   (2UL)
+#endif /* DMACOPY_CUTOVER_HALFWORD_MUL */
+#if !defined (DMACOPY_CUTOVER_BYTE_MUL)
+#define DMACOPY_CUTOVER_BYTE_MUL       (4UL)
+#endif /* DMACOPY_CUTOVER_BYTE_MUL */
+
+/*!< Transfer widths timed by DMACOPY_Benchmark(): byte, half-word, word */
+#define DMACOPY_NB_WIDTHS              (3UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Copy_Exported_Types
+  * @{
+  */
+
+typedef void (*DMACOPY_CallbackTypeDef)(void *Context);
+
+/**
+  * @brief Copy engine statistics.
+  */
+typedef struct
+{
+  uint32_t CpuRequests;                  /*!< Requests served by the CPU                 */
+  uint32_t DmaRequests;                  /*!< Requests served by the DMA                 */
+  uint32_t DmaBytes;                     /*!< Bytes moved by the DMA                     */
+  uint32_t Errors;                       /*!< DMA transfer errors                        */
+} DMACOPY_StatsTypeDef;
+
+/**
+  * @brief Copy times of one size, by transfer width.
+  * @note  Cycles are sampled from SysTick->VAL, valid when SysTick runs from
+  *        HCLK and each copy is shorter than one SysTick period. Index 0 is
+  *        the byte width, 1 half-word, 2 word. The DMA figure runs from the
+  *        channel setup to the transfer complete flag, polled; the interrupt
+  *        entry of a normal request comes on top. The DMA is worth it from
+  *        the smallest size whose DmaCycles are below CpuCycles, or earlier
+  *        when the CPU has other work to do meanwhile.
+  */
+typedef struct
+{
+  uint32_t Size;                         /*!< Bytes per copy                             */
+  uint32_t CpuCycles[DMACOPY_NB_WIDTHS]; /*!< memcpy() by the CPU                        */
+  uint32_t DmaCycles[DMACOPY_NB_WIDTHS]; /*!< Same copy by the DMA                       */
+} DMACOPY_BenchmarkTypeDef;
+
+/**
+  * @brief Copy engine handle.
+  */
+typedef struct
+{
+  DMA_Channel_TypeDef *Channel;          /*!< Free DMA channel reserved for copies       */
+  uint32_t Cutover;                      /*!< CPU/DMA cutover size in bytes, for word
+                                              aligned requests                           */
+  uint32_t Priority;                     /*!< DMA_CCR_PL value                           */
+
+  volatile uint32_t Busy;                /*!< Non zero while a DMA request is running    */
+  volatile ErrorStatus Status;           /*!< Result of the last DMA request             */
+  uint32_t Fill;                         /*!< Replicated memset pattern (internal)       */
+  uint32_t Source;                       /*!< Next source address (internal)             */
+  uint32_t Destination;                  /*!< Next destination address (internal)        */
+  uint32_t Remaining;                    /*!< Data units left to transfer (internal)     */
+  uint32_t CCRValue;                     /*!< CCR value without EN (internal)            */
+  DMACOPY_CallbackTypeDef Callback;      /*!< Completion callback (internal)             */
+  void *Context;                         /*!< Completion callback context (internal)     */
+  DMACOPY_StatsTypeDef Stats;            /*!< Statistics                                 */
+} DMACOPY_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Copy_Exported_Functions
+  * @{
+  */
+
+ErrorStatus DMACOPY_Init(DMACOPY_HandleTypeDef *hcopy, DMA_Channel_TypeDef *Channel);
+ErrorStatus DMACOPY_Memcpy(DMACOPY_HandleTypeDef *hcopy, void *Dst, const void *Src, uint32_t Size,
+                           DMACOPY_CallbackTypeDef Callback, void *Context);
+ErrorStatus DMACOPY_Memset(DMACOPY_HandleTypeDef *hcopy, void *Dst, uint8_t Value, uint32_t Size,
+                           DMACOPY_CallbackTypeDef Callback, void *Context);
+ErrorStatus DMACOPY_Wait(DMACOPY_HandleTypeDef *hcopy);
+void        DMACOPY_IRQHandler(DMACOPY_HandleTypeDef *hcopy);
+void        DMACOPY_FlagsHandler(void *Context, uint32_t Flags);
+ErrorStatus DMACOPY_Benchmark(DMACOPY_HandleTypeDef *hcopy, void *Dst, const void *Src, uint32_t Size,
+                              DMACOPY_BenchmarkTypeDef *Result);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_DMA_COPY_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
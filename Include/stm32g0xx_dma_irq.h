@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_irq.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMA interrupt demultiplexer header file.
+  *
+  *          The DMA channels above channel 3 share one interrupt vector with
+  *          the DMAMUX1 overrun interrupt (DMA1_Ch4_5_DMAMUX1_OVR_IRQn,
+  *          DMA1_Ch4_7_DMAMUX1_OVR_IRQn or, on devices with DMA2,
+  *          DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR_IRQn).
+  *
+  *          Instead of testing each channel flag group in sequence, the
+  *          demultiplexer:
+  *           - snapshots DMA1->ISR (and DMA2->ISR)
+  *           - masks the snapshot with the flag groups of the registered
+  *             channels served by the vector
+  *           - clears all of them with a single IFCR write per controller
+  *           - calls the registered handler of each pending channel, passing
+  *             the flags of that channel
+  *
+  *          Handlers receive flags already cleared and must not read ISR.
+  *          DMACHAIN_FlagsHandler() and DMACOPY_FlagsHandler() can be
+  *          registered directly with their handle as context.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_irq
+  * @{
+  */
+
+#ifndef STM32G0XX_DMA_IRQ_H
+#define STM32G0XX_DMA_IRQ_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Channel handler, called with the channel flags (DMA_UTIL_FLAG_xx).
+  */
+typedef void (*DMAIRQ_HandlerTypeDef)(void *Context, uint32_t Flags);
+
+/**
+  * @brief DMAMUX1 overrun handler, called with the DMAMUX_CSR and DMAMUX_RGSR
+  *        snapshots, already cleared.
+  */
+typedef void (*DMAIRQ_OverrunHandlerTypeDef)(void *Context, uint32_t SyncOverruns, uint32_t GenOverruns);
+
+/**
+  * @brief Demultiplexer statistics.
+  * @note  Cycles are sampled from SysTick and only valid when SysTick runs
+  *        from HCLK. They cover the whole shared vector handler, callbacks
+  *        included.
+  */
+typedef struct
+{
+  uint32_t Invocations;                  /*!< Shared vector handler calls          */
+  uint32_t Dispatches;                   /*!< Channel handler calls                */
+  uint32_t Overruns;                     /*!< DMAMUX1 overrun events               */
+  uint32_t LastCycles;                   /*!< Cost of the last shared vector call  */
+  uint32_t MaxCycles;                    /*!< Worst cost of a shared vector call   */
+} DMAIRQ_StatsTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Exported_Functions
+  * @{
+  */
+
+ErrorStatus DMAIRQ_Register(const DMA_Channel_TypeDef *Channel, DMAIRQ_HandlerTypeDef Handler, void *Context);
+void        DMAIRQ_Unregister(const DMA_Channel_TypeDef *Channel);
+void        DMAIRQ_RegisterOverrun(DMAIRQ_OverrunHandlerTypeDef Handler, void *Context);
+
+void        DMAIRQ_Channel1_IRQHandler(void);
+void        DMAIRQ_Channel2_3_IRQHandler(void);
+void        DMAIRQ_Shared_IRQHandler(void);
+
+void        DMAIRQ_GetStats(DMAIRQ_StatsTypeDef *Stats);
+void        DMAIRQ_ResetStats(void);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_DMA_IRQ_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
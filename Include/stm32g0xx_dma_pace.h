@@ -0,0 +1,195 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_pace.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMAMUX1 request generator paced transfers header.
+  *
+  *          A DMAMUX1 request generator (DMAMUX1_RequestGenerator0..3) turns
+  *          an EXTI line, LPTIM output or TIM14 compare event into a burst of
+  *          1 to 32 DMA requests. Routing a DMA channel to a generator gives a
+  *          fixed rate stream with no CPU involvement per sample, e.g.:
+  *           - GPIO pattern output: memory to GPIOx->BSRR, 32-bit, paced by
+  *             LPTIM1_OUT
+  *           - DAC sample playback: memory to DAC->DHR12R1, 16-bit, paced by
+  *             LPTIM2_OUT
+  *           - GPIO sampling: GPIOx->IDR to memory, paced by an EXTI line
+  *
+  *          In circular mode the half and full transfer callbacks let the
+  *          application refill the idle half of the buffer. A trigger arriving
+  *          while the previous burst is still pending sets the generator
+  *          overrun flag in DMAMUX1_RequestGenStatus->RGSR; it is counted and
+  *          reported through the overrun callback.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_pace
+  * @{
+  */
+
+#ifndef STM32G0XX_DMA_PACE_H
+#define STM32G0XX_DMA_PACE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_DMA_Pace_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Pace_Exported_Constants
+  * @{
+  */
+
+/** @defgroup DMA_Pace_Signal Request generator trigger inputs (DMAMUX_RGxCR_SIG_ID)
+  * @{
+  */
+#define DMAPACE_SIGNAL_EXTI(LINE)      ((uint32_t)(LINE))  /*!< EXTI line 0 to 15         */
+#define DMAPACE_SIGNAL_DMAMUX_EVT0     (16UL)              /*!< DMAMUX1 channel 0 event   */
+#define DMAPACE_SIGNAL_DMAMUX_EVT1     (17UL)              /*!< DMAMUX1 channel 1 event   */
+#define DMAPACE_SIGNAL_DMAMUX_EVT2     (18UL)              /*!< DMAMUX1 channel 2 event   */
+#define DMAPACE_SIGNAL_DMAMUX_EVT3     (19UL)              /*!< DMAMUX1 channel 3 event   */
+#if defined(LPTIM1)
+#define DMAPACE_SIGNAL_LPTIM1_OUT      (20UL)              /*!< LPTIM1 output             */
+#define DMAPACE_SIGNAL_LPTIM2_OUT      (21UL)              /*!< LPTIM2 output             */
+#endif /* LPTIM1 */
+#define DMAPACE_SIGNAL_TIM14_OC        (22UL)              /*!< TIM14 output compare      */
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Pace_Polarity Trigger edge
+  * @{
+  */
+#define DMAPACE_POLARITY_RISING        (DMAMUX_RGxCR_GPOL_0)
+#define DMAPACE_POLARITY_FALLING       (DMAMUX_RGxCR_GPOL_1)
+#define DMAPACE_POLARITY_BOTH          (DMAMUX_RGxCR_GPOL_0 | DMAMUX_RGxCR_GPOL_1)
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Pace_Direction Transfer direction
+  * @{
+  */
+#define DMAPACE_DIR_MEM_TO_PERIPH      (DMA_CCR_DIR)
+#define DMAPACE_DIR_PERIPH_TO_MEM      (0UL)
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Pace_Data_Size Data unit size, for both memory and peripheral
+  * @{
+  */
+#define DMAPACE_SIZE_BYTE              (0UL)
+#define DMAPACE_SIZE_HALFWORD          (1UL)
+#define DMAPACE_SIZE_WORD              (2UL)
+/**
+  * @}
+  */
+
+#define DMAPACE_MAX_REQUESTS           (32UL)   /*!< Upper bound of RequestsPerTrigger */
+#define DMAPACE_NB_GENERATORS          (4UL)    /*!< DMAMUX1 request generators        */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Pace_Exported_Types
+  * @{
+  */
+
+typedef struct DMAPACE_Handle DMAPACE_HandleTypeDef;
+
+typedef void (*DMAPACE_CallbackTypeDef)(DMAPACE_HandleTypeDef *hpace);
+
+/**
+  * @brief Paced transfer statistics.
+  */
+typedef struct
+{
+  uint32_t Buffers;                      /*!< Completed buffer passes             */
+  uint32_t Overruns;                     /*!< Trigger overruns (RGSR)             */
+  uint32_t Errors;                       /*!< DMA transfer errors                 */
+} DMAPACE_StatsTypeDef;
+
+/**
+  * @brief Paced transfer handle.
+  */
+struct DMAPACE_Handle
+{
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel                                 */
+  uint32_t Generator;                    /*!< Request generator, 0 to 3                   */
+  uint32_t Signal;                       /*!< DMAPACE_SIGNAL_xx                           */
+  uint32_t Polarity;                     /*!< DMAPACE_POLARITY_xx                         */
+  uint32_t RequestsPerTrigger;           /*!< DMA requests per trigger, 1 to 32           */
+  uint32_t Direction;                    /*!< DMAPACE_DIR_xx                              */
+  uint32_t DataSize;                     /*!< DMAPACE_SIZE_xx                             */
+  uint32_t Circular;                     /*!< Non zero to loop over the buffer            */
+  uint32_t OverrunIT;                    /*!< Non zero to enable the overrun interrupt    */
+  uint32_t PeriphAddress;                /*!< e.g. (uint32_t)&GPIOA->BSRR                 */
+  uint32_t MemAddress;                   /*!< Sample buffer                               */
+  uint32_t Length;                       /*!< Buffer length in data units, 1 to 65535     */
+  DMAPACE_CallbackTypeDef HalfCallback;     /*!< First half done, circular refill point   */
+  DMAPACE_CallbackTypeDef CompleteCallback; /*!< Buffer done                              */
+  DMAPACE_CallbackTypeDef OverrunCallback;  /*!< Trigger overrun detected                 */
+  DMAPACE_CallbackTypeDef ErrorCallback;    /*!< DMA transfer error                       */
+
+  volatile uint32_t Running;             /*!< Non zero while the stream runs (internal)   */
+  DMAPACE_StatsTypeDef Stats;            /*!< Statistics                                  */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Pace_Exported_Functions
+  * @{
+  */
+
+ErrorStatus DMAPACE_Init(DMAPACE_HandleTypeDef *hpace);
+ErrorStatus DMAPACE_Start(DMAPACE_HandleTypeDef *hpace);
+void        DMAPACE_Stop(DMAPACE_HandleTypeDef *hpace);
+uint32_t    DMAPACE_GetPosition(const DMAPACE_HandleTypeDef *hpace);
+uint32_t    DMAPACE_CheckOverrun(DMAPACE_HandleTypeDef *hpace);
+void        DMAPACE_IRQHandler(DMAPACE_HandleTypeDef *hpace);
+void        DMAPACE_FlagsHandler(void *Context, uint32_t Flags);
+void        DMAPACE_OverrunFlagsHandler(void *Context, uint32_t SyncOverruns, uint32_t GenOverruns);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_DMA_PACE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
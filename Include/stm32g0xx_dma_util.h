@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_util.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMA channel helper functions.
+  *
+  *          This file provides inline helpers shared by the DMA based
+  *          components of this package:
+  *           - Translation of a DMA_Channel_TypeDef pointer into its DMA
+  *             controller, channel index and DMAMUX1 channel
+  *           - Per channel access to the ISR/IFCR flag groups
+  *           - SysTick based cycle measurement used for statistics
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_util
+  * @{
+  */
+
+#ifndef STM32G0XX_DMA_UTIL_H
+#define STM32G0XX_DMA_UTIL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_DMA_Util_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Util_Exported_Constants
+  * @{
+  */
+
+/* Per channel flag group, as found in DMA_ISR/DMA_IFCR once shifted down */
+#define DMA_UTIL_FLAG_GI          (0x1UL)   /*!< Global interrupt flag          */
+#define DMA_UTIL_FLAG_TC          (0x2UL)   /*!< Transfer complete flag         */
+#define DMA_UTIL_FLAG_HT          (0x4UL)   /*!< Half transfer flag             */
+#define DMA_UTIL_FLAG_TE          (0x8UL)   /*!< Transfer error flag            */
+#define DMA_UTIL_FLAG_ALL         (0xFUL)   /*!< All flags of one channel       */
+
+#define DMA_UTIL_CHANNEL_STRIDE   (0x14UL)  /*!< Address step between channels */
+
+#if defined(DMA1_Channel7)
+#define DMA_UTIL_DMA1_NB_CHANNELS (7UL)     /*!< Channels on DMA1               */
+#else
+#define DMA_UTIL_DMA1_NB_CHANNELS (5UL)     /*!< Channels on DMA1               */
+#endif /* DMA1_Channel7 */
+
+#if defined(DMA2)
+#define DMA_UTIL_DMA2_NB_CHANNELS (5UL)     /*!< Channels on DMA2               */
+#else
+#define DMA_UTIL_DMA2_NB_CHANNELS (0UL)     /*!< Channels on DMA2               */
+#endif /* DMA2 */
+
+/* Total number of DMA channels, which is also the number of DMAMUX1 channels */
+#define DMA_UTIL_NB_CHANNELS      (DMA_UTIL_DMA1_NB_CHANNELS + DMA_UTIL_DMA2_NB_CHANNELS)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Util_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Return the DMA controller owning a channel.
+  * @param  Channel DMA channel (DMA1_Channel1..DMA2_Channel5)
+  * @retval DMA1 or DMA2
+  */
+__STATIC_INLINE DMA_TypeDef *DMA_UTIL_GetController(const DMA_Channel_TypeDef *Channel)
+{
+#if defined(DMA2)
+  if ((uint32_t)Channel >= DMA2_Channel1_BASE)
+  {
+    return DMA2;
+  }
+#else
+  (void)Channel;
+#endif /* DMA2 */
+  return DMA1;
+}
+
+/**
+  * @brief  Return the index of a channel inside its controller.
+  * @param  Channel DMA channel (DMA1_Channel1..DMA2_Channel5)
+  * @retval 0 for DMAx_Channel1, 1 for DMAx_Channel2, ...
+  */
+__STATIC_INLINE uint32_t DMA_UTIL_GetChannelIndex(const DMA_Channel_TypeDef *Channel)
+{
+#if defined(DMA2)
+  if ((uint32_t)Channel >= DMA2_Channel1_BASE)
+  {
+    return ((uint32_t)Channel - DMA2_Channel1_BASE) / DMA_UTIL_CHANNEL_STRIDE;
+  }
+#endif /* DMA2 */
+  return ((uint32_t)Channel - DMA1_Channel1_BASE) / DMA_UTIL_CHANNEL_STRIDE;
+}
+
+/**
+  * @brief  Return the package wide index of a channel.
+  * @note   DMA1 channels come first, followed by DMA2 channels. This is also
+  *         the index of the DMAMUX1 channel feeding the DMA channel.
+  * @param  Channel DMA channel (DMA1_Channel1..DMA2_Channel5)
+  * @retval 0 .. DMA_UTIL_NB_CHANNELS - 1
+  */
+__STATIC_INLINE uint32_t DMA_UTIL_GetGlobalIndex(const DMA_Channel_TypeDef *Channel)
+{
+#if defined(DMA2)
+  if ((uint32_t)Channel >= DMA2_Channel1_BASE)
+  {
+    return DMA_UTIL_DMA1_NB_CHANNELS + (((uint32_t)Channel - DMA2_Channel1_BASE) / DMA_UTIL_CHANNEL_STRIDE);
+  }
+#endif /* DMA2 */
+  return ((uint32_t)Channel - DMA1_Channel1_BASE) / DMA_UTIL_CHANNEL_STRIDE;
+}
+
+/**
+  * @brief  Return the DMA channel matching a package wide index.
+  * @param  Index 0 .. DMA_UTIL_NB_CHANNELS - 1
+  * @retval DMA channel
+  */
+__STATIC_INLINE DMA_Channel_TypeDef *DMA_UTIL_GetChannel(uint32_t Index)
+{
+#if defined(DMA2)
+  if (Index >= DMA_UTIL_DMA1_NB_CHANNELS)
+  {
+    return (DMA_Channel_TypeDef *)(DMA2_Channel1_BASE + ((Index - DMA_UTIL_DMA1_NB_CHANNELS) * DMA_UTIL_CHANNEL_STRIDE));
+  }
+#endif /* DMA2 */
+  return (DMA_Channel_TypeDef *)(DMA1_Channel1_BASE + (Index * DMA_UTIL_CHANNEL_STRIDE));
+}
+
+/**
+  * @brief  Return the DMAMUX1 channel feeding a DMA channel.
+  * @param  Channel DMA channel (DMA1_Channel1..DMA2_Channel5)
+  * @retval DMAMUX1 channel
+  */
+__STATIC_INLINE DMAMUX_Channel_TypeDef *DMA_UTIL_GetMuxChannel(const DMA_Channel_TypeDef *Channel)
+{
+  return DMAMUX1_Channel0 + DMA_UTIL_GetGlobalIndex(Channel);
+}
+
+/**
+  * @brief  Read the flag group of a channel.
+  * @param  Channel DMA channel
+  * @retval Combination of DMA_UTIL_FLAG_xx
+  */
+__STATIC_INLINE uint32_t DMA_UTIL_GetFlags(const DMA_Channel_TypeDef *Channel)
+{
+  return (DMA_UTIL_GetController(Channel)->ISR >> (DMA_UTIL_GetChannelIndex(Channel) * 4UL)) & DMA_UTIL_FLAG_ALL;
+}
+
+/**
+  * @brief  Clear flags of a channel with a single IFCR write.
+  * @param  Channel DMA channel
+  * @param  Flags Combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+__STATIC_INLINE void DMA_UTIL_ClearFlags(const DMA_Channel_TypeDef *Channel, uint32_t Flags)
+{
+  DMA_UTIL_GetController(Channel)->IFCR = (Flags & DMA_UTIL_FLAG_ALL) << (DMA_UTIL_GetChannelIndex(Channel) * 4UL);
+}
+
+/**
+  * @brief  Enable the clock of the controller owning a channel.
+  * @note   DMAMUX1 is clocked together with DMA1.
+  * @param  Channel DMA channel
+  * @retval None
+  */
+__STATIC_INLINE void DMA_UTIL_EnableClock(const DMA_Channel_TypeDef *Channel)
+{
+  SET_BIT(RCC->AHBENR, RCC_AHBENR_DMA1EN);
+#if defined(DMA2)
+  if (DMA_UTIL_GetController(Channel) == DMA2)
+  {
+    SET_BIT(RCC->AHBENR, RCC_AHBENR_DMA2EN);
+  }
+#else
+  (void)Channel;
+#endif /* DMA2 */
+  (void)READ_BIT(RCC->AHBENR, RCC_AHBENR_DMA1EN);
+}
+
+/**
+  * @brief  Sample the SysTick down-counter for cycle measurements.
+  * @retval Current SysTick value
+  */
+__STATIC_INLINE uint32_t DMA_UTIL_CycleStamp(void)
+{
+  return SysTick->VAL;
+}
+
+/**
+  * @brief  Cycles elapsed between two DMA_UTIL_CycleStamp() samples.
+  * @note   Only meaningful when SysTick runs from HCLK and the interval is
+  *         shorter than one SysTick period.
+  * @param  Start first sample
+  * @param  End second sample
+  * @retval Elapsed cycles, 0 when SysTick is stopped
+  */
+__STATIC_INLINE uint32_t DMA_UTIL_CycleElapsed(uint32_t Start, uint32_t End)
+{
+  if ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0UL)
+  {
+    return 0UL;
+  }
+  if (Start >= End)
+  {
+    return Start - End;
+  }
+  return Start + ((SysTick->LOAD & SysTick_LOAD_RELOAD_Msk) + 1UL) - End;
+}
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_DMA_UTIL_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,278 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dmamux_route.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx compile-time DMAMUX1 request routing.
+  *
+  *          This file provides:
+  *           - The DMAMUX1 request IDs (DMAMUX_REQ_xx), only defined for the
+  *             peripherals present on the selected device
+  *           - A routing table mechanism that maps peripheral requests onto
+  *             DMA channels, rejects conflicting assignments at compile time
+  *             and expands into the minimal DMAMUX1 register init sequence
+  *
+  *          The routing table is an X-macro listing (channel, request) pairs:
+  *
+  *            #define APP_DMA_ROUTES(ROUTE)   \
+  *              ROUTE(DMA1_CH1, USART2_RX)    \
+  *              ROUTE(DMA1_CH2, USART2_TX)    \
+  *              ROUTE(DMA1_CH3, SPI1_RX)
+  *
+  *            DMAMUX_ROUTE_DECLARE(APP_DMA_ROUTES)
+  *
+  *            void app_dma_init(void)
+  *            {
+  *              DMAMUX_ROUTE_APPLY(APP_DMA_ROUTES);
+  *            }
+  *
+  *          DMAMUX_ROUTE_DECLARE() fails to compile when:
+  *           - two requests share a channel (redeclared enumerator
+  *             DMAMUX_ROUTE_CHANNEL_xx)
+  *           - a request is routed twice (redeclared enumerator
+  *             DMAMUX_ROUTE_REQUEST_xx)
+  *           - the channel does not exist on the device (7 channels on
+  *             G07x/G08x, 5 on G03x/G04x, 12 on G0Bx/G0C1 with DMA2)
+  *           - the requesting peripheral does not exist on the device
+  *
+  *          DMAMUX_ROUTE_CHANNEL(USART2_RX) then yields the DMA channel
+  *          serving a request, as a constant folded expression.
+  *          Only one routing table may be declared per translation unit.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dmamux_route
+  * @{
+  */
+
+#ifndef STM32G0XX_DMAMUX_ROUTE_H
+#define STM32G0XX_DMAMUX_ROUTE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_DMAMUX_Route_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMAMUX_Route_Exported_Constants
+  * @{
+  */
+
+/** @defgroup DMAMUX_Route_Channel_Index DMA channel to DMAMUX1 channel index
+  * @{
+  */
+#define DMAMUX_ROUTE_IDX_DMA1_CH1      0U
+#define DMAMUX_ROUTE_IDX_DMA1_CH2      1U
+#define DMAMUX_ROUTE_IDX_DMA1_CH3      2U
+#define DMAMUX_ROUTE_IDX_DMA1_CH4      3U
+#define DMAMUX_ROUTE_IDX_DMA1_CH5      4U
+#if defined(DMA1_Channel7)
+#define DMAMUX_ROUTE_IDX_DMA1_CH6      5U
+#define DMAMUX_ROUTE_IDX_DMA1_CH7      6U
+#endif /* DMA1_Channel7 */
+#if defined(DMA2)
+#define DMAMUX_ROUTE_IDX_DMA2_CH1      7U
+#define DMAMUX_ROUTE_IDX_DMA2_CH2      8U
+#define DMAMUX_ROUTE_IDX_DMA2_CH3      9U
+#define DMAMUX_ROUTE_IDX_DMA2_CH4      10U
+#define DMAMUX_ROUTE_IDX_DMA2_CH5      11U
+#endif /* DMA2 */
+/**
+  * @}
+  */
+
+/** @defgroup DMAMUX_Route_Request_ID DMAMUX1 request IDs (DMAMUX_CxCR_DMAREQ_ID)
+  * @{
+  */
+#define DMAMUX_REQ_MEM2MEM             0U     /*!< No request, memory to memory transfers */
+#define DMAMUX_REQ_GENERATOR0          1U
+#define DMAMUX_REQ_GENERATOR1          2U
+#define DMAMUX_REQ_GENERATOR2          3U
+#define DMAMUX_REQ_GENERATOR3          4U
+#define DMAMUX_REQ_ADC1                5U
+#if defined(AES)
+#define DMAMUX_REQ_AES_IN              6U
+#define DMAMUX_REQ_AES_OUT             7U
+#endif /* AES */
+#if defined(DAC1)
+#define DMAMUX_REQ_DAC1_CH1            8U
+#define DMAMUX_REQ_DAC1_CH2            9U
+#endif /* DAC1 */
+#define DMAMUX_REQ_I2C1_RX             10U
+#define DMAMUX_REQ_I2C1_TX             11U
+#define DMAMUX_REQ_I2C2_RX             12U
+#define DMAMUX_REQ_I2C2_TX             13U
+#if defined(LPUART1)
+#define DMAMUX_REQ_LPUART1_RX          14U
+#define DMAMUX_REQ_LPUART1_TX          15U
+#endif /* LPUART1 */
+#define DMAMUX_REQ_SPI1_RX             16U
+#define DMAMUX_REQ_SPI1_TX             17U
+#define DMAMUX_REQ_SPI2_RX             18U
+#define DMAMUX_REQ_SPI2_TX             19U
+#define DMAMUX_REQ_TIM1_CH1            20U
+#define DMAMUX_REQ_TIM1_CH2            21U
+#define DMAMUX_REQ_TIM1_CH3            22U
+#define DMAMUX_REQ_TIM1_CH4            23U
+#define DMAMUX_REQ_TIM1_TRIG_COM       24U
+#define DMAMUX_REQ_TIM1_UP             25U
+#if defined(TIM2)
+#define DMAMUX_REQ_TIM2_CH1            26U
+#define DMAMUX_REQ_TIM2_CH2            27U
+#define DMAMUX_REQ_TIM2_CH3            28U
+#define DMAMUX_REQ_TIM2_CH4            29U
+#define DMAMUX_REQ_TIM2_TRIG           30U
+#define DMAMUX_REQ_TIM2_UP             31U
+#endif /* TIM2 */
+#define DMAMUX_REQ_TIM3_CH1            32U
+#define DMAMUX_REQ_TIM3_CH2            33U
+#define DMAMUX_REQ_TIM3_CH3            34U
+#define DMAMUX_REQ_TIM3_CH4            35U
+#define DMAMUX_REQ_TIM3_TRIG           36U
+#define DMAMUX_REQ_TIM3_UP             37U
+#if defined(TIM6)
+#define DMAMUX_REQ_TIM6_UP             38U
+#define DMAMUX_REQ_TIM7_UP             39U
+#endif /* TIM6 */
+#if defined(TIM15)
+#define DMAMUX_REQ_TIM15_CH1           40U
+#define DMAMUX_REQ_TIM15_CH2           41U
+#define DMAMUX_REQ_TIM15_TRIG_COM      42U
+#define DMAMUX_REQ_TIM15_UP            43U
+#endif /* TIM15 */
+#define DMAMUX_REQ_TIM16_CH1           44U
+#define DMAMUX_REQ_TIM16_COM           45U
+#define DMAMUX_REQ_TIM16_UP            46U
+#define DMAMUX_REQ_TIM17_CH1           47U
+#define DMAMUX_REQ_TIM17_COM           48U
+#define DMAMUX_REQ_TIM17_UP            49U
+#define DMAMUX_REQ_USART1_RX           50U
+#define DMAMUX_REQ_USART1_TX           51U
+#define DMAMUX_REQ_USART2_RX           52U
+#define DMAMUX_REQ_USART2_TX           53U
+#if defined(USART3)
+#define DMAMUX_REQ_USART3_RX           54U
+#define DMAMUX_REQ_USART3_TX           55U
+#define DMAMUX_REQ_USART4_RX           56U
+#define DMAMUX_REQ_USART4_TX           57U
+#endif /* USART3 */
+#if defined(UCPD1)
+#define DMAMUX_REQ_UCPD1_RX            58U
+#define DMAMUX_REQ_UCPD1_TX            59U
+#define DMAMUX_REQ_UCPD2_RX            60U
+#define DMAMUX_REQ_UCPD2_TX            61U
+#endif /* UCPD1 */
+#if defined(I2C3)
+#define DMAMUX_REQ_I2C3_RX             62U
+#define DMAMUX_REQ_I2C3_TX             63U
+#endif /* I2C3 */
+#if defined(LPUART2)
+#define DMAMUX_REQ_LPUART2_RX          64U
+#define DMAMUX_REQ_LPUART2_TX          65U
+#endif /* LPUART2 */
+#if defined(SPI3)
+#define DMAMUX_REQ_SPI3_RX             66U
+#define DMAMUX_REQ_SPI3_TX             67U
+#endif /* SPI3 */
+#if defined(TIM4)
+#define DMAMUX_REQ_TIM4_CH1            68U
+#define DMAMUX_REQ_TIM4_CH2            69U
+#define DMAMUX_REQ_TIM4_CH3            70U
+#define DMAMUX_REQ_TIM4_CH4            71U
+#define DMAMUX_REQ_TIM4_TRIG           72U
+#define DMAMUX_REQ_TIM4_UP             73U
+#endif /* TIM4 */
+#if defined(USART5)
+#define DMAMUX_REQ_USART5_RX           74U
+#define DMAMUX_REQ_USART5_TX           75U
+#define DMAMUX_REQ_USART6_RX           76U
+#define DMAMUX_REQ_USART6_TX           77U
+#endif /* USART5 */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMAMUX_Route_Exported_Macros
+  * @{
+  */
+
+/* Table entry expanders, for use by the macros below */
+#define DMAMUX_ROUTE_CHANNEL_ENTRY(CH, REQ)  DMAMUX_ROUTE_CHANNEL_##CH = DMAMUX_ROUTE_IDX_##CH,
+#define DMAMUX_ROUTE_REQUEST_ENTRY(CH, REQ)  DMAMUX_ROUTE_REQUEST_##REQ = DMAMUX_ROUTE_IDX_##CH + (0U * DMAMUX_REQ_##REQ),
+#define DMAMUX_ROUTE_WRITE_ENTRY(CH, REQ)    DMAMUX1_Channel0[DMAMUX_ROUTE_IDX_##CH].CCR = DMAMUX_REQ_##REQ;
+
+/**
+  * @brief  Declare a routing table and check it at compile time.
+  * @param  TABLE X-macro taking ROUTE(channel, request) entries
+  */
+#define DMAMUX_ROUTE_DECLARE(TABLE)                                          \
+  enum { TABLE(DMAMUX_ROUTE_CHANNEL_ENTRY) DMAMUX_ROUTE_CHANNEL_END_ };      \
+  enum { TABLE(DMAMUX_ROUTE_REQUEST_ENTRY) DMAMUX_ROUTE_REQUEST_END_ };
+
+/**
+  * @brief  Write the DMAMUX1 channel registers listed in a routing table.
+  * @note   Expands to one constant-address store per routed channel; channels
+  *         absent from the table are left untouched. The DMA1 clock, which
+  *         also clocks DMAMUX1, must be enabled beforehand.
+  * @param  TABLE X-macro taking ROUTE(channel, request) entries
+  */
+#define DMAMUX_ROUTE_APPLY(TABLE)                                            \
+  do { TABLE(DMAMUX_ROUTE_WRITE_ENTRY) } while (0)
+
+/**
+  * @brief  DMA channel serving a request of the declared routing table.
+  * @param  REQ request name without the DMAMUX_REQ_ prefix (e.g. USART2_RX)
+  * @retval DMA_Channel_TypeDef pointer
+  */
+#define DMAMUX_ROUTE_CHANNEL(REQ)      DMA_UTIL_GetChannel((uint32_t)DMAMUX_ROUTE_REQUEST_##REQ)
+
+/**
+  * @brief  DMAMUX1 channel serving a request of the declared routing table.
+  * @param  REQ request name without the DMAMUX_REQ_ prefix (e.g. USART2_RX)
+  * @retval DMAMUX_Channel_TypeDef pointer
+  */
+#define DMAMUX_ROUTE_MUX_CHANNEL(REQ)  (DMAMUX1_Channel0 + (uint32_t)DMAMUX_ROUTE_REQUEST_##REQ)
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_DMAMUX_ROUTE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
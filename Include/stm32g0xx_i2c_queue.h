@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2c_queue.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx I2C master DMA transaction queue header file.
+  *
+  *          Master transactions are queued per device and run from the I2C
+  *          interrupt without per-byte polling:
+  *           - data move through one transmit and one receive DMA channel;
+  *             the I2C interrupt only sees transfer complete (reload), STOP,
+  *             NACK and bus errors
+  *           - a transaction writes TxLength bytes then, after a repeated
+  *             start, reads RxLength bytes; either length may be zero, both
+  *             zero probes the address
+  *           - phases longer than 255 bytes are split with I2C_CR2_RELOAD,
+  *             the DMA channel runs over the whole phase
+  *           - each device has its own FIFO queue; devices with pending
+  *             transactions are served round robin, one transaction per turn
+  *           - the next transaction is started before the completion
+  *             callback runs
+  *
+  *          Transactions are caller-owned and must not be modified until
+  *          their callback ran. TIMINGR is configured by the application.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2c_queue
+  * @{
+  */
+
+#ifndef STM32G0XX_I2C_QUEUE_H
+#define STM32G0XX_I2C_QUEUE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_I2C_Queue_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Queue_Exported_Constants
+  * @{
+  */
+
+/** @defgroup I2C_Queue_Error Transaction error causes
+  * @{
+  */
+#define I2CQ_ERROR_NONE                (0x00UL)
+#define I2CQ_ERROR_NACK                (0x01UL)  /*!< Address or data not acknowledged */
+#define I2CQ_ERROR_BUS                 (0x02UL)  /*!< Bus error, arbitration lost, overrun */
+#define I2CQ_ERROR_DMA                 (0x04UL)  /*!< DMA transfer error            */
+/**
+  * @}
+  */
+
+#define I2CQ_CHUNK_MAX                 (255UL)   /*!< Bytes per NBYTES load         */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Queue_Exported_Types
+  * @{
+  */
+
+typedef struct I2CQ_Transaction I2CQ_TransactionTypeDef;
+typedef struct I2CQ_Device I2CQ_DeviceTypeDef;
+
+/**
+  * @brief Completion callback, Status is ERROR when Transaction->Error is set.
+  */
+typedef void (*I2CQ_CallbackTypeDef)(I2CQ_TransactionTypeDef *Transaction, ErrorStatus Status);
+
+/**
+  * @brief I2C transaction: optional write, then optional read.
+  */
+struct I2CQ_Transaction
+{
+  const uint8_t *TxData;                 /*!< Bytes written                      */
+  uint8_t *RxData;                       /*!< Bytes read after a repeated start  */
+  uint16_t TxLength;                     /*!< Write length, 0 for a plain read   */
+  uint16_t RxLength;                     /*!< Read length, 0 for a plain write   */
+  I2CQ_CallbackTypeDef Callback;         /*!< Completion, may be NULL            */
+  void *Context;                         /*!< Application data                   */
+  uint32_t Error;                        /*!< I2CQ_ERROR_xx, set on completion   */
+
+  uint32_t SubmitStamp;                  /*!< TimeBase at submission (internal)  */
+  I2CQ_TransactionTypeDef *Next;         /*!< Queue link (internal)              */
+};
+
+/**
+  * @brief Target device and its transaction queue.
+  */
+struct I2CQ_Device
+{
+  uint32_t Address;                      /*!< 7-bit address                      */
+
+  I2CQ_TransactionTypeDef *Head;         /*!< First queued (internal)            */
+  I2CQ_TransactionTypeDef *Tail;         /*!< Last queued (internal)             */
+  I2CQ_DeviceTypeDef *Next;              /*!< Device ring link (internal)        */
+};
+
+/**
+  * @brief Queue statistics.
+  * @note  Times are in TimeBase ticks and stay 0 without TimeBase. Latency
+  *        runs from I2CQ_Submit() to completion, queueing included.
+  *        Bytes / BusyTicks is the throughput while the bus is in use.
+  */
+typedef struct
+{
+  uint32_t Transactions;                 /*!< Completed without error            */
+  uint32_t Bytes;                        /*!< Bytes written and read             */
+  uint32_t Nacks;                        /*!< Transactions ended by a NACK       */
+  uint32_t BusErrors;                    /*!< Bus errors, arbitration losses     */
+  uint32_t DmaErrors;                    /*!< DMA transfer errors                */
+  uint32_t BusyTicks;                    /*!< Time with a transaction running    */
+  uint32_t LastLatency;                  /*!< Latest transaction latency         */
+  uint32_t MaxLatency;                   /*!< Worst transaction latency          */
+} I2CQ_StatsTypeDef;
+
+/**
+  * @brief Queue handle.
+  */
+typedef struct
+{
+  I2C_TypeDef *Instance;                 /*!< I2C instance, TIMINGR set          */
+  DMA_Channel_TypeDef *TxChannel;        /*!< Transmit DMA channel               */
+  DMA_Channel_TypeDef *RxChannel;        /*!< Receive DMA channel                */
+  uint32_t TxRequest;                    /*!< DMAMUX_REQ_I2Cx_TX                 */
+  uint32_t RxRequest;                    /*!< DMAMUX_REQ_I2Cx_RX                 */
+  uint32_t Priority;                     /*!< DMA_CCR_PL value                   */
+  const volatile uint32_t *TimeBase;     /*!< Free-running counter, NULL for none */
+  uint32_t TimeBaseMask;                 /*!< Counter width, e.g. 0xFFFF for a
+                                              16-bit timer                       */
+
+  I2CQ_DeviceTypeDef *Cursor;            /*!< Last served device (internal)      */
+  I2CQ_TransactionTypeDef * volatile Current; /*!< Running transaction (internal) */
+  I2CQ_DeviceTypeDef *CurrentDevice;     /*!< Its device (internal)              */
+  uint32_t Remaining;                    /*!< Phase bytes not yet in NBYTES (internal) */
+  uint32_t PhaseEnd;                     /*!< Phase CR2 AUTOEND bit (internal)   */
+  uint32_t StartStamp;                   /*!< TimeBase at start (internal)       */
+  I2CQ_StatsTypeDef Stats;               /*!< Statistics                         */
+} I2CQ_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Queue_Exported_Functions
+  * @{
+  */
+
+ErrorStatus I2CQ_Init(I2CQ_HandleTypeDef *hi2cq);
+ErrorStatus I2CQ_AddDevice(I2CQ_HandleTypeDef *hi2cq, I2CQ_DeviceTypeDef *Device);
+ErrorStatus I2CQ_Submit(I2CQ_HandleTypeDef *hi2cq, I2CQ_DeviceTypeDef *Device,
+                        I2CQ_TransactionTypeDef *Transaction);
+uint32_t    I2CQ_IsIdle(const I2CQ_HandleTypeDef *hi2cq);
+void        I2CQ_IRQHandler(I2CQ_HandleTypeDef *hi2cq);
+void        I2CQ_DMA_IRQHandler(I2CQ_HandleTypeDef *hi2cq);
+void        I2CQ_DmaFlagsHandler(void *Context, uint32_t Flags);
+void        I2CQ_ResetStats(I2CQ_HandleTypeDef *hi2cq);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_I2C_QUEUE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2c_regmap.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx I2C slave register map header file.
+  *
+  *          The I2C slave exposes an 8-bit addressed register map:
+  *           - host write: [offset] [data ...]; the data bytes are moved by
+  *             DMA straight into the write window at offset, the write
+  *             callback reports the updated range at STOP or repeated start
+  *           - host read: [offset] Sr [read ...], or a plain read from the
+  *             last offset; the bytes are moved by DMA straight out of the
+  *             published read snapshot
+  *
+  *          Only the offset byte and the address/STOP events are handled by
+  *          the CPU, the clock being stretched meanwhile. Bytes beyond a
+  *          window are discarded (write) or read as I2CREG_FILL_BYTE.
+  *
+  *          The read map is double-buffered: the application fills the back
+  *          buffer returned by I2CREG_BeginUpdate() and publishes it with
+  *          I2CREG_Publish(). A host read always uses the buffer published
+  *          when its address phase started, so it never sees a partial
+  *          update.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2c_regmap
+  * @{
+  */
+
+#ifndef STM32G0XX_I2C_REGMAP_H
+#define STM32G0XX_I2C_REGMAP_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Exported_Constants
+  * @{
+  */
+
+#define I2CREG_FILL_BYTE               (0xFFU)   /*!< Read beyond the read map     */
+#define I2CREG_MAP_MAX                 (256UL)   /*!< 8-bit register offsets       */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Exported_Types
+  * @{
+  */
+
+typedef struct I2CREG_Handle I2CREG_HandleTypeDef;
+
+/**
+  * @brief Write callback, runs in the I2C interrupt.
+  * @note  WriteMap[Offset] to WriteMap[Offset + Length - 1] were written by
+  *        the host.
+  */
+typedef void (*I2CREG_WriteCallbackTypeDef)(I2CREG_HandleTypeDef *hreg, uint32_t Offset, uint32_t Length);
+
+/**
+  * @brief Slave statistics.
+  */
+typedef struct
+{
+  uint32_t Reads;                        /*!< Host read transfers              */
+  uint32_t Writes;                       /*!< Host writes with data            */
+  uint32_t WriteBytes;                   /*!< Bytes stored in the write window */
+  uint32_t Overflows;                    /*!< Bytes beyond a window            */
+  uint32_t Publishes;                    /*!< Snapshots published              */
+  uint32_t UpdateBusy;                   /*!< I2CREG_BeginUpdate() refusals    */
+  uint32_t Errors;                       /*!< Bus and DMA errors               */
+} I2CREG_StatsTypeDef;
+
+/**
+  * @brief Register map handle.
+  */
+struct I2CREG_Handle
+{
+  I2C_TypeDef *Instance;                 /*!< I2C instance, TIMINGR set        */
+  uint32_t OwnAddress;                   /*!< 7-bit slave address              */
+  DMA_Channel_TypeDef *TxChannel;        /*!< Read map DMA channel             */
+  DMA_Channel_TypeDef *RxChannel;        /*!< Write window DMA channel         */
+  uint32_t TxRequest;                    /*!< DMAMUX_REQ_I2Cx_TX               */
+  uint32_t RxRequest;                    /*!< DMAMUX_REQ_I2Cx_RX               */
+  uint8_t *Snapshot[2];                  /*!< Read map buffers, ReadSize each  */
+  uint32_t ReadSize;                     /*!< Read map size, 1 to 256          */
+  uint8_t *WriteMap;                     /*!< Write window, NULL if read-only  */
+  uint32_t WriteSize;                    /*!< Write window size, 0 to 256      */
+  I2CREG_WriteCallbackTypeDef WriteCallback; /*!< Host write report, may be NULL */
+
+  volatile uint32_t Front;               /*!< Published snapshot (internal)    */
+  volatile uint32_t Reading;             /*!< Snapshot being read (internal)   */
+  uint32_t Phase;                        /*!< Transfer phase (internal)        */
+  uint32_t Offset;                       /*!< Register offset (internal)       */
+  uint32_t Window;                       /*!< DMA window length (internal)     */
+  I2CREG_StatsTypeDef Stats;             /*!< Statistics                       */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Exported_Functions
+  * @{
+  */
+
+ErrorStatus I2CREG_Init(I2CREG_HandleTypeDef *hreg);
+uint8_t    *I2CREG_BeginUpdate(I2CREG_HandleTypeDef *hreg);
+void        I2CREG_Publish(I2CREG_HandleTypeDef *hreg);
+void        I2CREG_IRQHandler(I2CREG_HandleTypeDef *hreg);
+void        I2CREG_DMA_IRQHandler(I2CREG_HandleTypeDef *hreg);
+void        I2CREG_TxFlagsHandler(void *Context, uint32_t Flags);
+void        I2CREG_RxFlagsHandler(void *Context, uint32_t Flags);
+void        I2CREG_ResetStats(I2CREG_HandleTypeDef *hreg);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_I2C_REGMAP_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,231 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2c_timing.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx precomputed I2C TIMINGR tables header file.
+  *
+  *          TIMINGR for Standard-mode (100 kHz), Fast-mode (400 kHz) and
+  *          Fast-mode Plus (1 MHz) is computed by the compiler for the usual
+  *          kernel clock operating points. At run time:
+  *           - the kernel clock of the instance is derived from RCC_CCIPR,
+  *             SystemCoreClock and the AHB / APB prescalers (no division)
+  *           - it is compared with the clock the cached table row was
+  *             selected for; only when it differs is a row looked up again,
+  *             or computed once into the handle for an unlisted clock by an
+  *             out-of-line copy of the solver (six 64-bit divisions per
+  *             mode); add a row to the table to avoid it
+  *
+  *          The solver is closed-form, without search:
+  *           - PRESC brings the timing clock to about 4, 8 or 16 MHz
+  *           - SCLL + SCLH fill the bit period left after the maximum rise
+  *             and fall times and the analog filter delays, split in the
+  *             ratio of the minimum tLOW / tHIGH, each at least its minimum
+  *           - SCLDEL covers tr + tSU;DAT, SDADEL covers tf
+  *          The result is conservative with the maximum bus rise and fall
+  *          times; the estimated SCL frequency is stored with each value.
+  *          Unreachable combinations, including kernel clocks below the
+  *          mode minimum, have TIMINGR = 0.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2c_timing
+  * @{
+  */
+
+#ifndef STM32G0XX_I2C_TIMING_H
+#define STM32G0XX_I2C_TIMING_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_I2C_Timing_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Exported_Constants
+  * @{
+  */
+
+/** @defgroup I2C_Timing_Modes Bus modes, table column order
+  * @note  X(ARG, speed, timing clock, min kernel clock, tLOW min, tHIGH min,
+  *        tSU;DAT min, tr max, tf max), times in ns
+  * @{
+  */
+#define I2CTIMING_MODES(X, ARG) \
+  X(ARG,  100000U,  4000000U,  2000000U, 4700U, 4000U, 250U, 1000U, 300U) \
+  X(ARG,  400000U,  8000000U,  8000000U, 1300U,  600U, 100U,  300U, 300U) \
+  X(ARG, 1000000U, 16000000U, 18000000U,  500U,  260U,  50U,  120U, 120U)
+
+#define I2CTIMING_NB_MODES             (3U)
+
+#define I2CTIMING_AF_NS                (50U)     /*!< Analog filter minimum delay  */
+/**
+  * @}
+  */
+
+/** @defgroup I2C_Timing_Macros Compile-time TIMINGR computation
+  * @{
+  */
+#define I2CTIMING_CEIL(N, D)           (((N) + (D) - 1U) / (D))
+#define I2CTIMING_DIV_ROUND(N, D)      (((N) + ((D) / 2U)) / (D))
+
+/* PRESC for a timing clock at most FT */
+#define I2CTIMING_PRESC(FCK, FT) \
+  ((I2CTIMING_CEIL((uint32_t)(FCK), (uint32_t)(FT)) > 16U) ? 15U : (I2CTIMING_CEIL((uint32_t)(FCK), (uint32_t)(FT)) - 1U))
+
+/* Timing clock periods covering NS nanoseconds */
+#define I2CTIMING_TICKS(FCK, P, NS) \
+  ((uint32_t)I2CTIMING_CEIL((uint64_t)(NS) * (FCK), (uint64_t)1000000000U * ((P) + 1U)))
+
+/* SCLL + SCLH + 2: bit period minus tr, tf and both filter delays */
+#define I2CTIMING_SUM(FCK, P, SPEED, TR, TF) \
+  I2CTIMING_TICKS(FCK, P, (1000000000U / (SPEED)) - (TR) - (TF) - (2U * I2CTIMING_AF_NS))
+
+#define I2CTIMING_LOW(FCK, P, SPEED, TLOW, THIGH, TR, TF) \
+  ((I2CTIMING_TICKS(FCK, P, TLOW) > I2CTIMING_CEIL(I2CTIMING_SUM(FCK, P, SPEED, TR, TF) * (TLOW), (TLOW) + (THIGH))) ? \
+   I2CTIMING_TICKS(FCK, P, TLOW) : I2CTIMING_CEIL(I2CTIMING_SUM(FCK, P, SPEED, TR, TF) * (TLOW), (TLOW) + (THIGH)))
+
+#define I2CTIMING_HIGH(FCK, P, SPEED, TLOW, THIGH, TR, TF) \
+  ((I2CTIMING_SUM(FCK, P, SPEED, TR, TF) > \
+    (I2CTIMING_LOW(FCK, P, SPEED, TLOW, THIGH, TR, TF) + I2CTIMING_TICKS(FCK, P, THIGH))) ? \
+   (I2CTIMING_SUM(FCK, P, SPEED, TR, TF) - I2CTIMING_LOW(FCK, P, SPEED, TLOW, THIGH, TR, TF)) : \
+   I2CTIMING_TICKS(FCK, P, THIGH))
+
+#define I2CTIMING_SCLDEL(FCK, P, TSU, TR) (I2CTIMING_TICKS(FCK, P, (TR) + (TSU)) - 1U)
+
+/* SDADEL: tf minus the filter delay and the 3 kernel clock synchronization */
+#define I2CTIMING_SDACYC(FCK, TF) \
+  ((uint32_t)I2CTIMING_CEIL((uint64_t)((TF) - I2CTIMING_AF_NS) * (FCK), (uint64_t)1000000000U))
+#define I2CTIMING_SDADEL(FCK, P, TF) \
+  ((I2CTIMING_SDACYC(FCK, TF) <= 3U) ? 0U : I2CTIMING_CEIL(I2CTIMING_SDACYC(FCK, TF) - 3U, (P) + 1U))
+
+#define I2CTIMING_VALID(FCK, FMIN, P, SPEED, TLOW, THIGH, TSU, TR, TF) \
+  (((uint32_t)(FCK) >= (FMIN)) && \
+   (I2CTIMING_LOW(FCK, P, SPEED, TLOW, THIGH, TR, TF) <= 256U) && \
+   (I2CTIMING_HIGH(FCK, P, SPEED, TLOW, THIGH, TR, TF) <= 256U) && \
+   (I2CTIMING_SCLDEL(FCK, P, TSU, TR) <= 15U) && (I2CTIMING_SDADEL(FCK, P, TF) <= 15U))
+
+/* TIMINGR for one kernel clock and one mode of I2CTIMING_MODES, 0 when unreachable */
+#define I2CTIMING_TIMINGR(FCK, SPEED, FT, FMIN, TLOW, THIGH, TSU, TR, TF) \
+  (I2CTIMING_VALID(FCK, FMIN, I2CTIMING_PRESC(FCK, FT), SPEED, TLOW, THIGH, TSU, TR, TF) ? \
+   (((uint32_t)I2CTIMING_PRESC(FCK, FT) << I2C_TIMINGR_PRESC_Pos) | \
+    ((uint32_t)I2CTIMING_SCLDEL(FCK, I2CTIMING_PRESC(FCK, FT), TSU, TR) << I2C_TIMINGR_SCLDEL_Pos) | \
+    ((uint32_t)I2CTIMING_SDADEL(FCK, I2CTIMING_PRESC(FCK, FT), TF) << I2C_TIMINGR_SDADEL_Pos) | \
+    ((uint32_t)(I2CTIMING_HIGH(FCK, I2CTIMING_PRESC(FCK, FT), SPEED, TLOW, THIGH, TR, TF) - 1U) << \
+     I2C_TIMINGR_SCLH_Pos) | \
+    ((uint32_t)(I2CTIMING_LOW(FCK, I2CTIMING_PRESC(FCK, FT), SPEED, TLOW, THIGH, TR, TF) - 1U) << \
+     I2C_TIMINGR_SCLL_Pos)) : 0U)
+
+/* Estimated SCL frequency of a TIMINGR value, with the maximum tr and tf */
+#define I2CTIMING_FREQUENCY(FCK, TIMINGR, TR, TF) \
+  ((uint32_t)(1000000000U / \
+   (I2CTIMING_DIV_ROUND((uint64_t)((((TIMINGR) & I2C_TIMINGR_SCLL) >> I2C_TIMINGR_SCLL_Pos) + \
+                                   (((TIMINGR) & I2C_TIMINGR_SCLH) >> I2C_TIMINGR_SCLH_Pos) + 2U) * \
+                        ((((TIMINGR) & I2C_TIMINGR_PRESC) >> I2C_TIMINGR_PRESC_Pos) + 1U) * 1000000000U, \
+                        (uint64_t)(FCK)) + (TR) + (TF) + (2U * I2CTIMING_AF_NS))))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief TIMINGR value for one bus mode.
+  */
+typedef struct
+{
+  uint32_t Timingr;                      /*!< TIMINGR value, 0 when unreachable  */
+  uint32_t Frequency;                    /*!< Estimated SCL frequency in Hz      */
+} I2CTIMING_EntryTypeDef;
+
+/**
+  * @brief TIMINGR values for all bus modes at one kernel clock.
+  */
+typedef struct
+{
+  uint32_t KernelClock;                  /*!< Kernel clock in Hz                 */
+  I2CTIMING_EntryTypeDef Entry[I2CTIMING_NB_MODES]; /*!< I2CTIMING_MODES order */
+} I2CTIMING_RowTypeDef;
+
+/**
+  * @brief Cache statistics.
+  */
+typedef struct
+{
+  uint32_t Lookups;                      /*!< Bus speeds looked up               */
+  uint32_t Rebuilds;                     /*!< Kernel clock changes seen          */
+  uint32_t RowsComputed;                 /*!< Rebuilds without a precomputed row */
+} I2CTIMING_StatsTypeDef;
+
+/**
+  * @brief TIMINGR cache, one per I2C instance.
+  */
+typedef struct
+{
+  I2C_TypeDef *Instance;                 /*!< I2C instance                      */
+
+  uint32_t KernelClock;                  /*!< Clock of the cached row (internal) */
+  const I2CTIMING_RowTypeDef *Row;       /*!< Cached row, NULL when invalid (internal) */
+  I2CTIMING_RowTypeDef Computed;         /*!< Row built for an unlisted clock (internal) */
+  I2CTIMING_StatsTypeDef Stats;          /*!< Statistics                        */
+} I2CTIMING_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Exported_Functions
+  * @{
+  */
+
+ErrorStatus I2CTIMING_Init(I2CTIMING_HandleTypeDef *htiming, I2C_TypeDef *Instance);
+uint32_t    I2CTIMING_GetKernelClock(const I2C_TypeDef *Instance);
+ErrorStatus I2CTIMING_Lookup(I2CTIMING_HandleTypeDef *htiming, uint32_t Speed, I2CTIMING_EntryTypeDef *Entry);
+ErrorStatus I2CTIMING_Set(I2CTIMING_HandleTypeDef *htiming, uint32_t Speed, uint32_t *Frequency);
+void        I2CTIMING_Invalidate(I2CTIMING_HandleTypeDef *htiming);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_I2C_TIMING_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2s_stream.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx I2S double-buffered DMA streaming header file.
+  *
+  *          One SPI/I2S instance streams 16-bit samples through a circular
+  *          DMA channel over a buffer split in two halves (ping-pong):
+  *           - the half transfer and transfer complete events hand the half
+  *             just released by the DMA to the refill callback, which fills
+  *             it (transmit) or consumes it (receive) while the DMA works on
+  *             the other half
+  *           - samples are Q15, stereo streams are interleaved left/right
+  *           - the callback has one half period of budget; its duration is
+  *             measured and a missed deadline is counted as late
+  *
+  *          In master mode the prescaler is derived from the I2S kernel
+  *          clock (RCC_CCIPR/RCC_CCIPR2 I2SxSEL, PLLCFGR and SystemCoreClock)
+  *          and the achieved sample rate is reported. Underrun and overrun
+  *          errors are counted from the SPI error interrupt.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2s_stream
+  * @{
+  */
+
+#ifndef STM32G0XX_I2S_STREAM_H
+#define STM32G0XX_I2S_STREAM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_I2S_Stream_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2S_Stream_Exported_Constants
+  * @{
+  */
+
+/** @defgroup I2S_Stream_Mode Transfer mode, SPI_I2SCFGR_I2SCFG values
+  * @{
+  */
+#define I2SSTREAM_MODE_SLAVE_TX        (0UL)
+#define I2SSTREAM_MODE_SLAVE_RX        (SPI_I2SCFGR_I2SCFG_0)
+#define I2SSTREAM_MODE_MASTER_TX       (SPI_I2SCFGR_I2SCFG_1)
+#define I2SSTREAM_MODE_MASTER_RX       (SPI_I2SCFGR_I2SCFG)
+/**
+  * @}
+  */
+
+/** @defgroup I2S_Stream_Standard Frame format, SPI_I2SCFGR values
+  * @{
+  */
+#define I2SSTREAM_STD_PHILIPS          (0UL)
+#define I2SSTREAM_STD_MSB              (SPI_I2SCFGR_I2SSTD_0)
+#define I2SSTREAM_STD_LSB              (SPI_I2SCFGR_I2SSTD_1)
+#define I2SSTREAM_STD_PCM_SHORT        (SPI_I2SCFGR_I2SSTD)
+#define I2SSTREAM_STD_PCM_LONG         (SPI_I2SCFGR_I2SSTD | SPI_I2SCFGR_PCMSYNC)
+/**
+  * @}
+  */
+
+/** @defgroup I2S_Stream_Channel Channel length, 16-bit data
+  * @{
+  */
+#define I2SSTREAM_CHANNEL_16BIT        (0UL)
+#define I2SSTREAM_CHANNEL_32BIT        (SPI_I2SCFGR_CHLEN)
+/**
+  * @}
+  */
+
+#define I2SSTREAM_DIV_MIN              (2UL)     /*!< Smallest valid I2SDIV        */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2S_Stream_Exported_Types
+  * @{
+  */
+
+typedef struct I2SSTREAM_Handle I2SSTREAM_HandleTypeDef;
+
+/**
+  * @brief Refill callback, runs in the DMA interrupt.
+  * @note  Samples points to the half released by the DMA: fill Count samples
+  *        before returning (transmit) or consume them (receive).
+  */
+typedef void (*I2SSTREAM_CallbackTypeDef)(I2SSTREAM_HandleTypeDef *hi2s, int16_t *Samples, uint32_t Count);
+
+/**
+  * @brief Stream statistics.
+  * @note  Cycles are sampled from SysTick->VAL, valid when SysTick runs from
+  *        HCLK and the callback is shorter than one SysTick period. Late
+  *        counts halves whose callback returned after the DMA had already
+  *        come back into them: stale samples were sent, or received samples
+  *        were overwritten.
+  */
+typedef struct
+{
+  uint32_t Halves;                       /*!< Callbacks run                    */
+  uint32_t Late;                         /*!< Missed half deadlines            */
+  uint32_t Underruns;                    /*!< SPI_SR_UDR, slave transmit       */
+  uint32_t Overruns;                     /*!< SPI_SR_OVR, receive              */
+  uint32_t DmaErrors;                    /*!< DMA transfer errors              */
+  uint32_t LastCycles;                   /*!< Latest callback duration         */
+  uint32_t MaxCycles;                    /*!< Worst callback duration          */
+} I2SSTREAM_StatsTypeDef;
+
+/**
+  * @brief Stream handle.
+  */
+struct I2SSTREAM_Handle
+{
+  SPI_TypeDef *Instance;                 /*!< SPI1, or SPI2 where I2S2 exists  */
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel                      */
+  uint32_t Request;                      /*!< DMAMUX_REQ_SPIx_TX or _RX        */
+  uint32_t Mode;                         /*!< I2SSTREAM_MODE_xx                */
+  uint32_t Standard;                     /*!< I2SSTREAM_STD_xx                 */
+  uint32_t ChannelLength;                /*!< I2SSTREAM_CHANNEL_xx             */
+  uint32_t MclkOutput;                   /*!< 1 to output MCK (256 x Fs)       */
+  uint32_t SampleRate;                   /*!< Frames per second, master modes  */
+  uint32_t KernelClock;                  /*!< I2S clock in Hz, 0 reads RCC;
+                                              required with I2S_CKIN           */
+  int16_t *Buffer;                       /*!< Two halves of HalfSamples        */
+  uint32_t HalfSamples;                  /*!< Samples per half, 1 to 32767     */
+  I2SSTREAM_CallbackTypeDef Callback;    /*!< Refill callback                  */
+
+  uint32_t ActualRate;                   /*!< Achieved sample rate (internal)  */
+  int32_t RateErrorPpm;                  /*!< Against SampleRate (internal)    */
+  I2SSTREAM_StatsTypeDef Stats;          /*!< Statistics                       */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2S_Stream_Exported_Functions
+  * @{
+  */
+
+uint32_t    I2SSTREAM_GetKernelClock(const SPI_TypeDef *Instance);
+ErrorStatus I2SSTREAM_Init(I2SSTREAM_HandleTypeDef *hi2s);
+void        I2SSTREAM_Start(I2SSTREAM_HandleTypeDef *hi2s);
+void        I2SSTREAM_Stop(I2SSTREAM_HandleTypeDef *hi2s);
+void        I2SSTREAM_I2S_IRQHandler(I2SSTREAM_HandleTypeDef *hi2s);
+void        I2SSTREAM_DMA_IRQHandler(I2SSTREAM_HandleTypeDef *hi2s);
+void        I2SSTREAM_FlagsHandler(void *Context, uint32_t Flags);
+void        I2SSTREAM_ResetStats(I2SSTREAM_HandleTypeDef *hi2s);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_I2S_STREAM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,181 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_lptim_wheel.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx LPTIM driven hierarchical timer wheel header file.
+  *
+  *          Software timeouts in large numbers, driven by one LPTIM without
+  *          a periodic tick:
+  *           - LPTIM_CNT, free running over 16 bits, is extended to a 32-bit
+  *             tick count; the compare match is never programmed more than
+  *             half a counter period ahead, which bounds the time between
+  *             two reads
+  *           - timers are hashed into LPWHEEL_LEVELS levels of LPWHEEL_SLOTS
+  *             slots by the highest 5-bit group in which their expiry
+  *             differs from the wheel time; start and cancel are O(1), a
+  *             slot is redistributed to the lower levels when the wheel time
+  *             reaches it
+  *           - per-level occupancy bitmaps give the next event without
+  *             walking the lists; LPTIM_CMP is programmed to it when it lies
+  *             within half a counter period
+  *
+  *          Clocked from LSE or LSI (RCC_CCIPR LPTIMxSEL), the LPTIM keeps
+  *          counting and its interrupt wakes the device from Stop mode.
+  *          Expiries are exact to the tick, except for events closer than
+  *          LPWHEEL_MIN_DELTA ticks to the compare write, which fire that
+  *          many ticks after it.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_lptim_wheel
+  * @{
+  */
+
+#ifndef STM32G0XX_LPTIM_WHEEL_H
+#define STM32G0XX_LPTIM_WHEEL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+#if defined(LPTIM1)
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Exported_Constants
+  * @{
+  */
+
+#define LPWHEEL_SLOT_BITS              (5U)                        /*!< Tick bits per level            */
+#define LPWHEEL_SLOTS                  (1UL << LPWHEEL_SLOT_BITS)  /*!< Slots per level                */
+#define LPWHEEL_LEVELS                 (7U)                        /*!< Levels covering 32 tick bits   */
+#define LPWHEEL_MAX_DELAY              (0x7FFF0000UL)              /*!< Longest delay in ticks         */
+#define LPWHEEL_MIN_DELTA              (3UL)                       /*!< Compare write latency in ticks */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Exported_Types
+  * @{
+  */
+
+typedef struct LPWHEEL_Timer LPWHEEL_TimerTypeDef;
+
+/**
+  * @brief Expiry callback, runs in the LPTIM interrupt.
+  * @note  The timer is idle on entry and may be started again.
+  */
+typedef void (*LPWHEEL_CallbackTypeDef)(LPWHEEL_TimerTypeDef *Timer);
+
+/**
+  * @brief Software timer, owned by the application.
+  * @note  Zero initialized before its first start.
+  */
+struct LPWHEEL_Timer
+{
+  LPWHEEL_CallbackTypeDef Callback;      /*!< Expiry callback                  */
+  void *Context;                         /*!< Application data                 */
+
+  uint32_t Expiry;                       /*!< Expiry tick (internal)           */
+  uint32_t Index;                        /*!< Level * LPWHEEL_SLOTS + slot
+                                              (internal)                       */
+  LPWHEEL_TimerTypeDef *Next;            /*!< Slot list (internal)             */
+  LPWHEEL_TimerTypeDef **Link;           /*!< Pointer to this timer, NULL when
+                                              idle (internal)                  */
+};
+
+/**
+  * @brief Wheel statistics.
+  * @note  Lateness is in ticks, from the expiry to the interrupt entry.
+  */
+typedef struct
+{
+  uint32_t Started;                      /*!< Timers started                   */
+  uint32_t Cancelled;                    /*!< Pending timers cancelled         */
+  uint32_t Expired;                      /*!< Callbacks run                    */
+  uint32_t Cascades;                     /*!< Timers moved to a lower level    */
+  uint32_t Interrupts;                   /*!< LPTIM interrupts                 */
+  uint32_t MaxLateness;                  /*!< Worst expiry lateness            */
+} LPWHEEL_StatsTypeDef;
+
+/**
+  * @brief Timer wheel handle.
+  */
+typedef struct
+{
+  LPTIM_TypeDef *Instance;               /*!< LPTIM1 or LPTIM2, kernel clock
+                                              selected by the application      */
+  uint32_t Prescaler;                    /*!< LPTIM_CFGR_PRESC value; one tick
+                                              is 2^PRESC kernel clocks         */
+
+  uint32_t Time;                         /*!< Extended tick count (internal)   */
+  uint32_t LastCount;                    /*!< LPTIM_CNT at the last read
+                                              (internal)                       */
+  uint32_t Current;                      /*!< Wheel time (internal)            */
+  uint32_t Target;                       /*!< Programmed match, event or
+                                              horizon (internal)               */
+  uint32_t Busy;                         /*!< Expiring timers (internal)       */
+  uint32_t Occupied[LPWHEEL_LEVELS];     /*!< Non-empty slots (internal)       */
+  LPWHEEL_TimerTypeDef *Slot[LPWHEEL_LEVELS][LPWHEEL_SLOTS]; /*!< (internal)   */
+  LPWHEEL_StatsTypeDef Stats;            /*!< Statistics                       */
+} LPWHEEL_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Exported_Functions
+  * @{
+  */
+
+ErrorStatus LPWHEEL_Init(LPWHEEL_HandleTypeDef *hwheel);
+ErrorStatus LPWHEEL_Start(LPWHEEL_HandleTypeDef *hwheel, LPWHEEL_TimerTypeDef *Timer, uint32_t Delay);
+void        LPWHEEL_Cancel(LPWHEEL_HandleTypeDef *hwheel, LPWHEEL_TimerTypeDef *Timer);
+uint32_t    LPWHEEL_IsPending(const LPWHEEL_TimerTypeDef *Timer);
+uint32_t    LPWHEEL_Now(LPWHEEL_HandleTypeDef *hwheel);
+void        LPWHEEL_IRQHandler(LPWHEEL_HandleTypeDef *hwheel);
+void        LPWHEEL_ResetStats(LPWHEEL_HandleTypeDef *hwheel);
+
+/**
+  * @}
+  */
+
+#endif /* LPTIM1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_LPTIM_WHEEL_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
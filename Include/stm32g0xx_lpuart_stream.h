@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_lpuart_stream.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx LPUART reception across Stop mode header file.
+  *
+  *          The LPUART keeps receiving in Stop 0 and Stop 1 when it is
+  *          clocked from HSI16 or LSE (USART_CR1_UESM). This component builds
+  *          on the zero-copy receiver of stm32g0xx_usart_dmarx.h:
+  *           - the idle loop calls LPSTREAM_Sleep(), which enters Stop and
+  *             returns only once a span was delivered, i.e. on an idle line
+  *             frame boundary or a half / full ring watermark
+  *           - in Stop the 8 byte receive FIFO (USART_CR1_FIFOEN) collects
+  *             the incoming bytes, the DMA request being held off; the
+  *             device wakes when the FIFO reaches the Wakeup threshold
+  *             (USART_CR3_RXFTCFG, RXFTIE), not on every byte
+  *           - the clocks are restored with interrupts still masked while
+  *             the FIFO absorbs up to 8 - threshold more bytes, then the
+  *             DMA request is released and the FIFO is emptied into the
+  *             ring; the device goes back to Stop if no frame or watermark
+  *             was reached
+  *
+  *          A frame tail shorter than the threshold stays in the FIFO until
+  *          more data arrive or the device wakes for another reason, e.g.
+  *          an LPTIM period bounding the delivery latency: LPSTREAM_Sleep()
+  *          then stays out of Stop until the tail is delivered as a frame.
+  *
+  *          Each clock restart is timed against an optional counter that
+  *          keeps running in Stop (LPTIM, RTC sub-second), and an overrun
+  *          pending once the clocks are back is accounted as data lost
+  *          during the restart.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_lpuart_stream
+  * @{
+  */
+
+#ifndef STM32G0XX_LPUART_STREAM_H
+#define STM32G0XX_LPUART_STREAM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_LPUART_Stream_Includes
+  * @{
+  */
+#include "stm32g0xx_usart_dmarx.h"
+/**
+  * @}
+  */
+
+#if defined(LPUART1)
+
+/** @addtogroup STM32G0xx_LPUART_Stream_Exported_Constants
+  * @{
+  */
+
+/** @defgroup LPUART_Stream_Stop_Mode Stop mode entered by LPSTREAM_Sleep()
+  * @{
+  */
+#define LPSTREAM_STOP0                 (0UL)                 /*!< Main regulator on, fastest wake-up */
+#define LPSTREAM_STOP1                 (PWR_CR1_LPMS_0)      /*!< Low-power regulator               */
+/**
+  * @}
+  */
+
+/** @defgroup LPUART_Stream_Wakeup Wake-up threshold (USART_CR3_RXFTCFG), bytes in the FIFO
+  * @{
+  */
+#define LPSTREAM_WAKEUP_1_BYTE         (0UL)                                   /*!< 7 bytes of headroom */
+#define LPSTREAM_WAKEUP_2_BYTES        (USART_CR3_RXFTCFG_0)                   /*!< 6 bytes of headroom */
+#define LPSTREAM_WAKEUP_4_BYTES        (USART_CR3_RXFTCFG_1)                   /*!< 4 bytes of headroom */
+#define LPSTREAM_WAKEUP_6_BYTES        (USART_CR3_RXFTCFG_1 | USART_CR3_RXFTCFG_0) /*!< 2 bytes of headroom */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPUART_Stream_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Stream statistics.
+  * @note  Restore times are in TimeBase ticks, from the end of WFI to the
+  *        return of ClockRestore. The hardware wake-up time of the selected
+  *        Stop mode is not seen by software and comes on top. BytesLost is a
+  *        lower bound: one overrun flag stands for at least one byte.
+  */
+typedef struct
+{
+  uint32_t StopEntries;                  /*!< WFI executed in Stop mode          */
+  uint32_t DataWakeups;                  /*!< Wake-ups on the FIFO threshold     */
+  uint32_t Events;                       /*!< Frames and watermarks delivered    */
+  uint32_t LastRestore;                  /*!< Latest clock restore time          */
+  uint32_t MaxRestore;                   /*!< Worst clock restore time           */
+  uint32_t BytesLost;                    /*!< Overruns across a clock restart    */
+} LPSTREAM_StatsTypeDef;
+
+typedef struct LPSTREAM_Handle LPSTREAM_HandleTypeDef;
+
+/**
+  * @brief Clock restore hook, e.g. restart the PLL and switch SYSCLK back.
+  */
+typedef void (*LPSTREAM_ClockRestoreTypeDef)(LPSTREAM_HandleTypeDef *hstream);
+
+/**
+  * @brief Stream handle.
+  * @note  Rx is configured as for USARTRX_Init(), with an LPUART instance;
+  *        its framing is forced to USARTRX_FRAMING_IDLE and its span
+  *        callback is taken from SpanCallback.
+  */
+struct LPSTREAM_Handle
+{
+  USARTRX_HandleTypeDef Rx;              /*!< Receiver, must stay first         */
+  USARTRX_SpanCallbackTypeDef SpanCallback; /*!< Application span callback     */
+  uint32_t StopMode;                     /*!< LPSTREAM_STOPx                    */
+  uint32_t Wakeup;                       /*!< LPSTREAM_WAKEUP_xx                */
+  LPSTREAM_ClockRestoreTypeDef ClockRestore; /*!< Called after each wake-up,
+                                              may be NULL                       */
+  const volatile uint32_t *TimeBase;     /*!< Counter running in Stop, NULL
+                                              disables restore timing           */
+  uint32_t TimeBaseMask;                 /*!< Counter width, e.g. 0xFFFF for LPTIM */
+
+  volatile uint32_t EventCount;          /*!< Spans delivered (internal)        */
+  uint32_t EventSeen;                    /*!< EventCount at the last return of
+                                              LPSTREAM_Sleep (internal)         */
+  LPSTREAM_StatsTypeDef Stats;           /*!< Statistics                        */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPUART_Stream_Exported_Functions
+  * @{
+  */
+
+ErrorStatus LPSTREAM_Init(LPSTREAM_HandleTypeDef *hstream);
+void        LPSTREAM_Start(LPSTREAM_HandleTypeDef *hstream);
+void        LPSTREAM_Stop(LPSTREAM_HandleTypeDef *hstream);
+uint32_t    LPSTREAM_Sleep(LPSTREAM_HandleTypeDef *hstream);
+void        LPSTREAM_USART_IRQHandler(LPSTREAM_HandleTypeDef *hstream);
+
+/**
+  * @}
+  */
+
+#endif /* LPUART1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_LPUART_STREAM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_mono_clock.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx 64-bit monotonic timer clock header file.
+  *
+  *          A free-running 32-bit counter at the timer kernel clock is
+  *          extended to 64 bits by counting its overflows in the update
+  *          interrupt:
+  *           - TIM2 (32-bit) where the part has it
+  *           - otherwise TIM3 (low 16 bits) chained to TIM1 (high 16 bits):
+  *             TIM3 sends its update event as TRGO, TIM1 counts it in
+  *             external clock mode 1 through its internal trigger
+  *
+  *          MONOCLK_Read() returns a consistent value without masking
+  *          interrupts: the overflow count is read before and after the
+  *          counter and the read is retried when it changed; a wrap whose
+  *          interrupt is still pending is detected from UIF. This requires
+  *          that no reader preempts the update interrupt, i.e. readers run
+  *          at the update interrupt priority or below.
+  *
+  *          With PSC = 0 and the APB prescaler at 1 the counter runs at
+  *          HCLK.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_mono_clock
+  * @{
+  */
+
+#ifndef STM32G0XX_MONO_CLOCK_H
+#define STM32G0XX_MONO_CLOCK_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_Mono_Clock_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Mono_Clock_Exported_Constants
+  * @{
+  */
+
+#if defined(TIM2)
+#define MONOCLK_IRQn                   TIM2_IRQn                  /*!< Update interrupt */
+#else
+#define MONOCLK_IRQn                   TIM1_BRK_UP_TRG_COM_IRQn   /*!< Update interrupt */
+#endif /* TIM2 */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Mono_Clock_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Monotonic clock handle.
+  */
+typedef struct
+{
+  TIM_TypeDef *High;                     /*!< TIM2, or TIM1 in the chain (internal) */
+  TIM_TypeDef *Low;                      /*!< NULL, or TIM3 in the chain (internal) */
+  volatile uint32_t Overflows;           /*!< 32-bit wraps (internal)           */
+} MONOCLK_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Mono_Clock_Exported_Functions
+  * @{
+  */
+
+void     MONOCLK_Init(MONOCLK_HandleTypeDef *hclk);
+uint64_t MONOCLK_Read(const MONOCLK_HandleTypeDef *hclk);
+uint32_t MONOCLK_Read32(const MONOCLK_HandleTypeDef *hclk);
+uint32_t MONOCLK_GetFrequency(void);
+void     MONOCLK_IRQHandler(MONOCLK_HandleTypeDef *hclk);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_MONO_CLOCK_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_spi_burst.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx SPI packed burst transfers header file.
+  *
+  *          With 8-bit frames the SPI FIFOs accept and deliver two frames
+  *          per half-word access to SPI_DR (data packing):
+  *           - transmit: a half-word store queues two frames, low byte first
+  *           - receive: with SPI_CR2_FRXTH cleared, RXNE rises once two
+  *             frames are in the receive FIFO and a half-word load returns
+  *             both
+  *
+  *          The polled transfers below halve the number of DR accesses and
+  *          status polls. For an odd length the last frame is moved with a
+  *          byte access, FRXTH being set again beforehand so that RXNE
+  *          rises on a single frame. At most 4 frames are in flight, which
+  *          keeps the 32-bit receive FIFO from overrunning.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_spi_burst
+  * @{
+  */
+
+#ifndef STM32G0XX_SPI_BURST_H
+#define STM32G0XX_SPI_BURST_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_SPI_Burst_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Burst_Exported_Constants
+  * @{
+  */
+
+#define SPIBURST_DUMMY_BYTE            (0xFFU)   /*!< Sent when TxData is NULL     */
+#define SPIBURST_FIFO_BYTES            (4UL)     /*!< Receive FIFO depth, 8-bit frames */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Burst_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Packed against byte-wise transfer cost.
+  * @note  SysTick cycles, valid when SysTick runs from HCLK and the transfer
+  *        is shorter than one SysTick period.
+  */
+typedef struct
+{
+  uint32_t Length;                       /*!< Frames per transfer            */
+  uint32_t BytewiseCycles;               /*!< One DR access per frame        */
+  uint32_t PackedCycles;                 /*!< Half-word DR accesses          */
+} SPIBURST_BenchmarkTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Burst_Exported_Functions
+  * @{
+  */
+
+ErrorStatus SPIBURST_Exchange(SPI_TypeDef *SPIx, const uint8_t *TxData, uint8_t *RxData, uint32_t Length);
+ErrorStatus SPIBURST_Write(SPI_TypeDef *SPIx, const uint8_t *Data, uint32_t Length);
+ErrorStatus SPIBURST_Read(SPI_TypeDef *SPIx, uint8_t *Data, uint32_t Length);
+ErrorStatus SPIBURST_Benchmark(SPI_TypeDef *SPIx, uint8_t *Buffer, uint32_t Length,
+                               SPIBURST_BenchmarkTypeDef *Result);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_SPI_BURST_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
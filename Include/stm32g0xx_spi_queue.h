@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_spi_queue.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx SPI DMA transaction queue header file.
+  *
+  *          Full-duplex transactions for several devices sharing one SPI
+  *          master are queued and run back to back:
+  *           - the chip select of each transaction is driven by a single
+  *             GPIO BSRR store (active low)
+  *           - transmit and receive use one DMA channel each; the receive
+  *             transfer complete interrupt marks the end of a transaction,
+  *             releases its chip select and launches the next transaction
+  *             before running the completion callback
+  *
+  *          Transactions are caller-owned and must not be modified until
+  *          their callback ran. The SPI is configured by the application
+  *          (master, 8-bit frames, clock); SPE stays set between
+  *          transactions.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_spi_queue
+  * @{
+  */
+
+#ifndef STM32G0XX_SPI_QUEUE_H
+#define STM32G0XX_SPI_QUEUE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_SPI_Queue_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Queue_Exported_Constants
+  * @{
+  */
+
+/* Transaction flags */
+#define SPIQ_FLAG_KEEP_CS              (0x0001U)  /*!< Leave CS asserted for the next transaction
+                                                       of the same device, e.g. command then data */
+
+#define SPIQ_DUMMY_BYTE                (0xFFU)    /*!< Sent when TxData is NULL            */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Queue_Exported_Types
+  * @{
+  */
+
+typedef struct SPIQ_Transaction SPIQ_TransactionTypeDef;
+
+/**
+  * @brief Completion callback, Status is ERROR after a DMA transfer error.
+  */
+typedef void (*SPIQ_CallbackTypeDef)(SPIQ_TransactionTypeDef *Transaction, ErrorStatus Status);
+
+/**
+  * @brief SPI transaction.
+  */
+struct SPIQ_Transaction
+{
+  GPIO_TypeDef *CsPort;                  /*!< Chip select port, NULL for none    */
+  uint32_t CsPin;                        /*!< Chip select pin mask (GPIO_BSRR_BS_x) */
+  const uint8_t *TxData;                 /*!< Data sent, NULL sends SPIQ_DUMMY_BYTE */
+  uint8_t *RxData;                       /*!< Data received, NULL discards       */
+  uint16_t Length;                       /*!< Frames, 1 to 65535                 */
+  uint16_t Flags;                        /*!< Combination of SPIQ_FLAG_xx        */
+  SPIQ_CallbackTypeDef Callback;         /*!< Completion, may be NULL            */
+  void *Context;                         /*!< Application data                   */
+
+  SPIQ_TransactionTypeDef *Next;         /*!< Queue link (internal)              */
+};
+
+/**
+  * @brief Queue statistics.
+  * @note  Cycles are sampled from SysTick->VAL, valid when SysTick runs from
+  *        HCLK and for transactions shorter than one SysTick period.
+  *        BusyCycles / (BusyCycles + GapCycles) is the bus utilisation while
+  *        transactions are queued back to back. The gap runs from the entry
+  *        of the receive complete interrupt to the assertion of the next
+  *        chip select; the interrupt entry latency comes on top.
+  */
+typedef struct
+{
+  uint32_t Transactions;                 /*!< Completed transactions             */
+  uint32_t Bytes;                        /*!< Frames exchanged                   */
+  uint32_t Errors;                       /*!< DMA transfer errors                */
+  uint32_t BusyCycles;                   /*!< Cycles with a transaction running  */
+  uint32_t GapCycles;                    /*!< Cycles between chained transactions */
+  uint32_t LastGapCycles;                /*!< Latest inter-transaction gap       */
+  uint32_t MaxGapCycles;                 /*!< Worst inter-transaction gap        */
+} SPIQ_StatsTypeDef;
+
+/**
+  * @brief Queue handle.
+  */
+typedef struct
+{
+  SPI_TypeDef *Instance;                 /*!< SPI master, configured and enabled */
+  DMA_Channel_TypeDef *TxChannel;        /*!< Transmit DMA channel               */
+  DMA_Channel_TypeDef *RxChannel;        /*!< Receive DMA channel                */
+  uint32_t TxRequest;                    /*!< DMAMUX_REQ_SPIx_TX                 */
+  uint32_t RxRequest;                    /*!< DMAMUX_REQ_SPIx_RX                 */
+  uint32_t Priority;                     /*!< DMA_CCR_PL value                   */
+
+  SPIQ_TransactionTypeDef * volatile Head; /*!< Running transaction (internal)   */
+  SPIQ_TransactionTypeDef *Tail;         /*!< Last queued transaction (internal) */
+  uint32_t StartStamp;                   /*!< SysTick at CS assertion (internal) */
+  uint8_t DummyTx;                       /*!< Dummy transmit byte (internal)     */
+  uint8_t DummyRx;                       /*!< Discarded receive byte (internal)  */
+  SPIQ_StatsTypeDef Stats;               /*!< Statistics                         */
+} SPIQ_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Queue_Exported_Functions
+  * @{
+  */
+
+ErrorStatus SPIQ_Init(SPIQ_HandleTypeDef *hspiq);
+ErrorStatus SPIQ_Submit(SPIQ_HandleTypeDef *hspiq, SPIQ_TransactionTypeDef *Transaction);
+uint32_t    SPIQ_IsIdle(const SPIQ_HandleTypeDef *hspiq);
+void        SPIQ_IRQHandler(SPIQ_HandleTypeDef *hspiq);
+void        SPIQ_RxFlagsHandler(void *Context, uint32_t Flags);
+void        SPIQ_TxFlagsHandler(void *Context, uint32_t Flags);
+void        SPIQ_ResetStats(SPIQ_HandleTypeDef *hspiq);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_SPI_QUEUE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
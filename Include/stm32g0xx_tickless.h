@@ -0,0 +1,182 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tickless.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx tickless idle timekeeping header file.
+  *
+  *          The system tick count runs from SysTick while the CPU is busy and
+  *          from an LPTIM while it is idle:
+  *           - TICKLESS_Idle() stops SysTick, programs the LPTIM compare to
+  *             the tick at which the application next needs the CPU, and
+  *             enters Sleep, Stop 0 or Stop 1 (PWR_CR1_LPMS) depending on
+  *             the expected idle length
+  *           - on any wake-up the ticks elapsed are taken from the LPTIM
+  *             count, in Stop as well, and SysTick is restarted; the sub-tick
+  *             remainder is carried over, so no time is lost across idle
+  *             periods
+  *           - wake-ups and the time spent in each mode are accounted, as a
+  *             proxy of the average supply current
+  *
+  *          The LPTIM must run from LSE or LSI (RCC_CCIPR LPTIMxSEL) to keep
+  *          counting in Stop mode, and its interrupt must be enabled in the
+  *          NVIC to wake the CPU. One idle period lasts at most half a
+  *          counter period: 1 s with a 32768 Hz LPTIM clock.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tickless
+  * @{
+  */
+
+#ifndef STM32G0XX_TICKLESS_H
+#define STM32G0XX_TICKLESS_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_Tickless_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+#if defined(LPTIM1)
+
+/** @addtogroup STM32G0xx_Tickless_Exported_Constants
+  * @{
+  */
+
+/** @defgroup Tickless_Mode Low-power mode of an idle period
+  * @{
+  */
+#define TICKLESS_MODE_SLEEP            (0UL)                 /*!< Sleep, SysTick suppressed        */
+#define TICKLESS_MODE_STOP0            (1UL)                 /*!< Stop 0, main regulator on        */
+#define TICKLESS_MODE_STOP1            (2UL)                 /*!< Stop 1, low-power regulator      */
+#define TICKLESS_NB_MODES              (3UL)
+/**
+  * @}
+  */
+
+#define TICKLESS_MAX_TICK_RATE         (10000UL)             /*!< Highest system tick rate in Hz   */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Tickless_Exported_Types
+  * @{
+  */
+
+typedef struct TICKLESS_Handle TICKLESS_HandleTypeDef;
+
+/**
+  * @brief Clock restore hook, e.g. restart the PLL and switch SYSCLK back.
+  * @note  Runs after each Stop exit, interrupts still masked.
+  */
+typedef void (*TICKLESS_ClockRestoreTypeDef)(TICKLESS_HandleTypeDef *htickless);
+
+/**
+  * @brief Idle statistics.
+  * @note  Times are in LPTIM ticks.
+  */
+typedef struct
+{
+  uint32_t Wakeups;                      /*!< Idle periods ended               */
+  uint32_t TimerWakeups;                 /*!< Ended by the programmed compare  */
+  uint32_t Aborted;                      /*!< Idle entries with a tick pending */
+  uint32_t Entries[TICKLESS_NB_MODES];   /*!< Idle periods per mode            */
+  uint32_t Time[TICKLESS_NB_MODES];      /*!< Time spent per mode              */
+} TICKLESS_StatsTypeDef;
+
+/**
+  * @brief Residency report since the last statistics reset.
+  */
+typedef struct
+{
+  uint32_t Elapsed;                      /*!< System ticks covered             */
+  uint32_t WakeupRate;                   /*!< Wake-ups per 1000 s              */
+  uint32_t ActivePpm;                    /*!< Time outside idle, in ppm        */
+  uint32_t ModePpm[TICKLESS_NB_MODES];   /*!< Time per mode, in ppm            */
+} TICKLESS_ReportTypeDef;
+
+/**
+  * @brief Tickless timekeeping handle.
+  */
+struct TICKLESS_Handle
+{
+  LPTIM_TypeDef *Instance;               /*!< LPTIM1 or LPTIM2, kernel clock
+                                              selected by the application      */
+  uint32_t Prescaler;                    /*!< LPTIM_CFGR_PRESC value           */
+  uint32_t LptimFrequency;               /*!< LPTIM tick rate after the
+                                              prescaler, e.g. 32768            */
+  uint32_t TickRate;                     /*!< System ticks per second          */
+  uint32_t Stop0Ticks;                   /*!< Shortest idle for Stop 0, 0 to
+                                              never use it                     */
+  uint32_t Stop1Ticks;                   /*!< Shortest idle for Stop 1, 0 to
+                                              never use it                     */
+  TICKLESS_ClockRestoreTypeDef ClockRestore; /*!< Called after Stop, may be NULL */
+
+  volatile uint32_t Ticks;               /*!< System tick count (internal)     */
+  uint32_t Fraction;                     /*!< Sub-tick remainder, in LPTIM
+                                              ticks times TickRate (internal)  */
+  uint32_t MaxIdleTicks;                 /*!< Longest idle period (internal)   */
+  uint32_t StatsTick;                    /*!< Ticks at the statistics reset
+                                              (internal)                       */
+  TICKLESS_StatsTypeDef Stats;           /*!< Statistics                       */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Tickless_Exported_Functions
+  * @{
+  */
+
+ErrorStatus TICKLESS_Init(TICKLESS_HandleTypeDef *htickless);
+uint32_t    TICKLESS_GetTick(const TICKLESS_HandleTypeDef *htickless);
+uint32_t    TICKLESS_Idle(TICKLESS_HandleTypeDef *htickless, uint32_t ExpectedTicks);
+void        TICKLESS_SysTickHandler(TICKLESS_HandleTypeDef *htickless);
+void        TICKLESS_IRQHandler(TICKLESS_HandleTypeDef *htickless);
+ErrorStatus TICKLESS_GetReport(const TICKLESS_HandleTypeDef *htickless, TICKLESS_ReportTypeDef *Report);
+void        TICKLESS_ResetStats(TICKLESS_HandleTypeDef *htickless);
+
+/**
+  * @}
+  */
+
+#endif /* LPTIM1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_TICKLESS_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,177 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tim_burst.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx timer DMA burst register update header file.
+  *
+  *          Each update event of a timer loads a whole register-set frame
+  *          from a RAM table, with no CPU involvement:
+  *           - TIMx_DCR selects the first register (DBA) and the frame size
+  *             (DBL); every update DMA request then moves one frame through
+  *             TIMx_DMAR
+  *           - a frame is a contiguous window of ARR, RCR, CCR1, CCR2, CCR3,
+  *             CCR4, or of CCR5, CCR6 (TIM1): BDTR, DCR, DMAR, OR1 and CCMR3
+  *             lie between CCR4 and CCR5, so both groups cannot be part of
+  *             the same burst
+  *           - the table is replayed circularly; an optional refill callback
+  *             receives each half of it once the DMA has moved on to the
+  *             other half
+  *
+  *          With the timer preloads enabled (ARPE, OCxPE) the frame written
+  *          at update event N takes effect at update event N + 1.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tim_burst
+  * @{
+  */
+
+#ifndef STM32G0XX_TIM_BURST_H
+#define STM32G0XX_TIM_BURST_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_TIM_Burst_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Burst_Exported_Constants
+  * @{
+  */
+
+/** @defgroup TIM_Burst_Register First register of a frame, TIMx_DCR DBA values
+  * @{
+  */
+#define TIMBURST_REG_ARR               (11UL)
+#define TIMBURST_REG_RCR               (12UL)
+#define TIMBURST_REG_CCR1              (13UL)
+#define TIMBURST_REG_CCR2              (14UL)
+#define TIMBURST_REG_CCR3              (15UL)
+#define TIMBURST_REG_CCR4              (16UL)
+#define TIMBURST_REG_CCR5              (22UL)
+#define TIMBURST_REG_CCR6              (23UL)
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Burst_Exported_Types
+  * @{
+  */
+
+typedef struct TIMBURST_Handle TIMBURST_HandleTypeDef;
+
+/**
+  * @brief Refill callback, runs in the DMA interrupt.
+  * @note  Frames points to NbFrames / 2 frames of Count words released by
+  *        the DMA; rewrite them before the DMA comes back.
+  */
+typedef void (*TIMBURST_CallbackTypeDef)(TIMBURST_HandleTypeDef *htim, uint32_t *Frames, uint32_t NbFrames);
+
+/**
+  * @brief Engine statistics.
+  * @note  Cycles are sampled from SysTick->VAL, valid when SysTick runs from
+  *        HCLK and the callback is shorter than one SysTick period.
+  */
+typedef struct
+{
+  uint32_t Frames;                       /*!< Frames moved (at half / full)  */
+  uint32_t Refills;                      /*!< Callbacks run                  */
+  uint32_t RefillCycles;                 /*!< Cycles spent in callbacks      */
+  uint32_t MaxRefillCycles;              /*!< Worst callback duration        */
+  uint32_t DmaErrors;                    /*!< DMA transfer errors            */
+} TIMBURST_StatsTypeDef;
+
+/**
+  * @brief CPU load of the register updates, by the CPU and by DMA burst.
+  * @note  Loads are in ppm of HCLK at UpdateRate updates per second. The
+  *        DMA figure covers the refill callbacks, not the interrupt entry.
+  */
+typedef struct
+{
+  uint32_t UpdateRate;                   /*!< Update events per second       */
+  uint32_t CpuFrameCycles;               /*!< One frame written by the CPU   */
+  uint32_t DmaFrameCycles;               /*!< Callback cycles per frame      */
+  uint32_t CpuLoadPpm;                   /*!< CPU update at UpdateRate       */
+  uint32_t DmaLoadPpm;                   /*!< DMA burst at UpdateRate        */
+} TIMBURST_BenchmarkTypeDef;
+
+/**
+  * @brief Burst engine handle.
+  */
+struct TIMBURST_Handle
+{
+  TIM_TypeDef *Instance;                 /*!< Timer, running or started by the
+                                              application                    */
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel                    */
+  uint32_t Request;                      /*!< DMAMUX_REQ_TIMx_UP             */
+  uint32_t Priority;                     /*!< DMA_CCR_PL value               */
+  uint32_t First;                        /*!< TIMBURST_REG_xx                */
+  uint32_t Count;                        /*!< Registers per frame            */
+  uint32_t *Table;                       /*!< NbFrames frames of Count words */
+  uint32_t NbFrames;                     /*!< Frames in the table, even      */
+  TIMBURST_CallbackTypeDef Callback;     /*!< Refill, NULL to replay the table */
+
+  TIMBURST_StatsTypeDef Stats;           /*!< Statistics                     */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Burst_Exported_Functions
+  * @{
+  */
+
+ErrorStatus TIMBURST_Init(TIMBURST_HandleTypeDef *htim);
+void        TIMBURST_Start(TIMBURST_HandleTypeDef *htim);
+void        TIMBURST_Stop(TIMBURST_HandleTypeDef *htim);
+void        TIMBURST_DMA_IRQHandler(TIMBURST_HandleTypeDef *htim);
+void        TIMBURST_FlagsHandler(void *Context, uint32_t Flags);
+ErrorStatus TIMBURST_Benchmark(TIMBURST_HandleTypeDef *htim, uint32_t UpdateRate,
+                               TIMBURST_BenchmarkTypeDef *Result);
+void        TIMBURST_ResetStats(TIMBURST_HandleTypeDef *htim);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_TIM_BURST_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,164 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tim_capture.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx timer input capture DMA engine header file.
+  *
+  *          Frequency, duty cycle and period jitter of a signal on TI1,
+  *          with one DMA request per period and no interrupt per edge:
+  *           - the counter runs free over its full range; CC1 captures the
+  *             rising edges, CC2 (optional) the falling edges of the same
+  *             input
+  *           - each CC1 request moves a record through a DMA burst on
+  *             TIMx_DMAR: CCR1, the rising edge, and CCR2, the falling
+  *             edge that preceded it; without duty only CCR1 is moved
+  *           - the circular record ring is processed per half: periods are
+  *             differences of rising edges modulo the counter range, so a
+  *             counter wrap between two edges is transparent as long as one
+  *             period is shorter than the counter range
+  *           - results are fixed point: mean period, frequency in mHz, duty
+  *             in ppm, peak-to-peak and RMS period jitter
+  *
+  *          TIMx_TISEL selects the TI1 source, e.g. LSI, LSE or MCO on
+  *          TIM16 / TIM17 for clock measurement.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tim_capture
+  * @{
+  */
+
+#ifndef STM32G0XX_TIM_CAPTURE_H
+#define STM32G0XX_TIM_CAPTURE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_TIM_Capture_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Capture_Exported_Types
+  * @{
+  */
+
+typedef struct TIMCAP_Handle TIMCAP_HandleTypeDef;
+
+/**
+  * @brief Batch result, over the periods completed in one half of the ring.
+  * @note  Ticks are timer counter periods (kernel clock / (PSC + 1)).
+  */
+typedef struct
+{
+  uint32_t Periods;                      /*!< Periods measured                 */
+  uint32_t Period;                       /*!< Mean period in ticks, rounded    */
+  uint32_t Frequency;                    /*!< Mean frequency in mHz            */
+  uint32_t DutyPpm;                      /*!< High time over period, 0 without
+                                              duty measurement                 */
+  uint32_t JitterPeak;                   /*!< Longest minus shortest period    */
+  uint32_t JitterRms;                    /*!< Period standard deviation, ticks
+                                              in Q24.8                         */
+} TIMCAP_ResultTypeDef;
+
+/**
+  * @brief Batch callback, runs in the DMA interrupt.
+  */
+typedef void (*TIMCAP_CallbackTypeDef)(TIMCAP_HandleTypeDef *hcap, const TIMCAP_ResultTypeDef *Result);
+
+/**
+  * @brief Engine statistics.
+  */
+typedef struct
+{
+  uint32_t Batches;                      /*!< Halves processed                 */
+  uint32_t Periods;                      /*!< Periods measured                 */
+  uint32_t Overcaptures;                 /*!< Batches with CC1OF set: edges
+                                              lost, DMA too slow               */
+  uint32_t BadDuty;                      /*!< Periods without a falling edge   */
+  uint32_t DmaErrors;                    /*!< DMA transfer errors              */
+} TIMCAP_StatsTypeDef;
+
+/**
+  * @brief Capture engine handle.
+  */
+struct TIMCAP_Handle
+{
+  TIM_TypeDef *Instance;                 /*!< Timer with CH1, clock enabled by
+                                              the application                  */
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel                      */
+  uint32_t Request;                      /*!< DMAMUX_REQ_TIMx_CH1              */
+  uint32_t Priority;                     /*!< DMA_CCR_PL value                 */
+  uint32_t Prescaler;                    /*!< TIMx_PSC value                   */
+  uint32_t InputSelect;                  /*!< TIMx_TISEL TI1SEL value          */
+  uint32_t Filter;                       /*!< Input filter, IC1F 0 to 15       */
+  uint32_t Duty;                         /*!< 1 to capture falling edges on
+                                              CC2, needs CH2                   */
+  uint32_t TimerClock;                   /*!< Kernel clock in Hz, 0 to derive
+                                              it from PCLK                     */
+  uint32_t *Buffer;                      /*!< NbRecords records of 1 word, or
+                                              2 words with Duty                */
+  uint32_t NbRecords;                    /*!< Records in the ring, even        */
+  TIMCAP_CallbackTypeDef Callback;       /*!< Batch results, may be NULL       */
+
+  uint32_t Mask;                         /*!< Counter range (internal)         */
+  uint32_t Words;                        /*!< Words per record (internal)      */
+  uint32_t Primed;                       /*!< LastRise valid (internal)        */
+  uint32_t LastRise;                     /*!< Previous rising edge (internal)  */
+  TIMCAP_ResultTypeDef Last;             /*!< Latest batch result              */
+  TIMCAP_StatsTypeDef Stats;             /*!< Statistics                       */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Capture_Exported_Functions
+  * @{
+  */
+
+ErrorStatus TIMCAP_Init(TIMCAP_HandleTypeDef *hcap);
+void        TIMCAP_Start(TIMCAP_HandleTypeDef *hcap);
+void        TIMCAP_Stop(TIMCAP_HandleTypeDef *hcap);
+void        TIMCAP_DMA_IRQHandler(TIMCAP_HandleTypeDef *hcap);
+void        TIMCAP_FlagsHandler(void *Context, uint32_t Flags);
+void        TIMCAP_ResetStats(TIMCAP_HandleTypeDef *hcap);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_TIM_CAPTURE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
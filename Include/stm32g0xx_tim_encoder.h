@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tim_encoder.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx timer quadrature encoder interface header file.
+  *
+  *          Quadrature position kept by the timer slave mode controller,
+  *          with no interrupt per overflow or per index pulse:
+  *           - TIMx_SMCR encoder mode counts the TI1 / TI2 edges up or down;
+  *             the counter runs over its full range
+  *           - the position is extended to 64 bits only when it is read: the
+  *             signed counter difference since the previous read is added
+  *             to a software base, which is exact while the encoder moves
+  *             less than half the counter range between two reads
+  *           - the index pulse, on TI3, is captured by CC3: the count at the
+  *             last index is read back lazily and extended the same way
+  *           - velocity comes from CNT snapshots moved by DMA into a ring
+  *             at a fixed rate, triggered by another request such as a
+  *             basic timer update; only the read computes it
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tim_encoder
+  * @{
+  */
+
+#ifndef STM32G0XX_TIM_ENCODER_H
+#define STM32G0XX_TIM_ENCODER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Exported_Constants
+  * @{
+  */
+
+/** @defgroup TIM_Encoder_Mode Encoder mode, TIMx_SMCR SMS values
+  * @{
+  */
+#define TIMENC_MODE_X2_TI1             (TIM_SMCR_SMS_0)                    /*!< TI1 edges        */
+#define TIMENC_MODE_X2_TI2             (TIM_SMCR_SMS_1)                    /*!< TI2 edges        */
+#define TIMENC_MODE_X4                 (TIM_SMCR_SMS_1 | TIM_SMCR_SMS_0)   /*!< TI1 and TI2 edges */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Encoder statistics.
+  * @note  MaxStep against half the counter range gives the margin left to
+  *        the lazy extension.
+  */
+typedef struct
+{
+  uint32_t Reads;                        /*!< Position reads                   */
+  uint32_t Indexes;                      /*!< Index pulses seen by the reads   */
+  uint32_t MaxStep;                      /*!< Largest move between two reads   */
+} TIMENC_StatsTypeDef;
+
+/**
+  * @brief Encoder handle.
+  */
+typedef struct
+{
+  TIM_TypeDef *Instance;                 /*!< Timer with CH1 and CH2, and CH3
+                                              for the index; clock enabled by
+                                              the application                  */
+  uint32_t Mode;                         /*!< TIMENC_MODE_xx                   */
+  uint32_t Filter;                       /*!< Input filter, ICxF 0 to 15       */
+  uint32_t Invert;                       /*!< 1 to count the other way         */
+  uint32_t Index;                        /*!< 1 to capture the index on CC3    */
+  DMA_Channel_TypeDef *SampleChannel;    /*!< DMA channel for CNT snapshots,
+                                              NULL without velocity            */
+  uint32_t SampleRequest;                /*!< DMAMUX request of the sampling
+                                              trigger, e.g. DMAMUX_REQ_TIM6_UP */
+  uint32_t SampleRate;                   /*!< Trigger rate in Hz               */
+  uint32_t Priority;                     /*!< DMA_CCR_PL value                 */
+  uint32_t *Samples;                     /*!< NbSamples CNT snapshots          */
+  uint32_t NbSamples;                    /*!< Ring length                      */
+
+  uint32_t Mask;                         /*!< Counter range (internal)         */
+  uint32_t LastCount;                    /*!< CNT at the last read (internal)  */
+  int64_t Position;                      /*!< Position at the last read
+                                              (internal)                       */
+  TIMENC_StatsTypeDef Stats;             /*!< Statistics                       */
+} TIMENC_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Exported_Functions
+  * @{
+  */
+
+ErrorStatus TIMENC_Init(TIMENC_HandleTypeDef *henc);
+void        TIMENC_Start(TIMENC_HandleTypeDef *henc);
+void        TIMENC_Stop(TIMENC_HandleTypeDef *henc);
+int64_t     TIMENC_GetPosition(TIMENC_HandleTypeDef *henc);
+int32_t     TIMENC_GetPosition32(TIMENC_HandleTypeDef *henc);
+void        TIMENC_SetPosition(TIMENC_HandleTypeDef *henc, int64_t Position);
+uint32_t    TIMENC_GetIndex(TIMENC_HandleTypeDef *henc, int64_t *Position);
+ErrorStatus TIMENC_GetVelocity(const TIMENC_HandleTypeDef *henc, uint32_t Window, int32_t *Velocity);
+void        TIMENC_ResetStats(TIMENC_HandleTypeDef *henc);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_TIM_ENCODER_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
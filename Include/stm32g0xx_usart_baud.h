@@ -0,0 +1,199 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_baud.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx precomputed USART / LPUART baud rate tables
+  *          header file.
+  *
+  *          BRR and PRESC for the standard baud rates are computed by the
+  *          compiler for the usual kernel clock operating points, together
+  *          with the resulting baud rate error. At run time:
+  *           - the kernel clock of the instance is derived from RCC_CCIPR,
+  *             SystemCoreClock and the AHB / APB prescalers (no division)
+  *           - it is compared with the clock the cached table row was
+  *             selected for; only when it differs is a row looked up again,
+  *             or computed once into the handle for an unlisted clock
+  *           - a standard rate is then a table read; other rates fall back
+  *             to a run time division
+  *
+  *          USARTs use PRESC = 1 and 16 times oversampling, LPUARTs the
+  *          smallest prescaler keeping BRR within 20 bits. Unreachable rates
+  *          have BRR = 0.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_baud
+  * @{
+  */
+
+#ifndef STM32G0XX_USART_BAUD_H
+#define STM32G0XX_USART_BAUD_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_USART_Baud_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Exported_Constants
+  * @{
+  */
+
+/** @defgroup USART_Baud_Rates Standard baud rates, table column order
+  * @{
+  */
+#define USARTBAUD_RATES(X, ARG) \
+  X(ARG, 1200U) X(ARG, 2400U) X(ARG, 4800U) X(ARG, 9600U) X(ARG, 19200U) X(ARG, 38400U) \
+  X(ARG, 57600U) X(ARG, 115200U) X(ARG, 230400U) X(ARG, 460800U) X(ARG, 921600U)
+
+#define USARTBAUD_NB_RATES             (11U)
+/**
+  * @}
+  */
+
+/** @defgroup USART_Baud_Macros Compile-time BRR computation
+  * @{
+  */
+#define USARTBAUD_DIV_ROUND(N, D)      (((N) + ((D) / 2U)) / (D))
+
+/* USART, PRESC = 1, OVER8 = 0: BRR = fck / baud, 16 <= BRR <= 0xFFFF */
+#define USARTBAUD_USART_RAW(FCK, BAUD) USARTBAUD_DIV_ROUND((uint32_t)(FCK), (uint32_t)(BAUD))
+#define USARTBAUD_USART_BRR(FCK, BAUD) \
+  (((USARTBAUD_USART_RAW(FCK, BAUD) >= 16U) && (USARTBAUD_USART_RAW(FCK, BAUD) <= 0xFFFFU)) ? \
+   USARTBAUD_USART_RAW(FCK, BAUD) : 0U)
+
+/* LPUART: PRESC code to divider (1, 2, 4, 6, 8, 10, 12, 16, 32, 64, 128, 256) */
+#define USARTBAUD_PRESC_DIV(CODE) \
+  (((CODE) <= 2U) ? (1U << (CODE)) : (((CODE) <= 6U) ? ((CODE) * 2U) : (1U << ((CODE) - 3U))))
+
+/* LPUART: BRR = 256 * fck / (presc * baud), 0x300 <= BRR <= 0xFFFFF */
+#define USARTBAUD_LPUART_RAW(FCK, BAUD, CODE) \
+  ((uint32_t)USARTBAUD_DIV_ROUND((uint64_t)(FCK) * 256U, (uint64_t)USARTBAUD_PRESC_DIV(CODE) * (BAUD)))
+#define USARTBAUD_LPUART_FITS(FCK, BAUD, CODE) (USARTBAUD_LPUART_RAW(FCK, BAUD, CODE) <= 0xFFFFFU)
+#define USARTBAUD_LPUART_PRESC(FCK, BAUD) \
+  (USARTBAUD_LPUART_FITS(FCK, BAUD, 0U) ? 0U : USARTBAUD_LPUART_FITS(FCK, BAUD, 1U) ? 1U : \
+   USARTBAUD_LPUART_FITS(FCK, BAUD, 2U) ? 2U : USARTBAUD_LPUART_FITS(FCK, BAUD, 3U) ? 3U : \
+   USARTBAUD_LPUART_FITS(FCK, BAUD, 4U) ? 4U : USARTBAUD_LPUART_FITS(FCK, BAUD, 5U) ? 5U : \
+   USARTBAUD_LPUART_FITS(FCK, BAUD, 6U) ? 6U : USARTBAUD_LPUART_FITS(FCK, BAUD, 7U) ? 7U : \
+   USARTBAUD_LPUART_FITS(FCK, BAUD, 8U) ? 8U : USARTBAUD_LPUART_FITS(FCK, BAUD, 9U) ? 9U : \
+   USARTBAUD_LPUART_FITS(FCK, BAUD, 10U) ? 10U : 11U)
+#define USARTBAUD_LPUART_BRR(FCK, BAUD) \
+  (((USARTBAUD_LPUART_RAW(FCK, BAUD, USARTBAUD_LPUART_PRESC(FCK, BAUD)) >= 0x300U) && \
+    USARTBAUD_LPUART_FITS(FCK, BAUD, USARTBAUD_LPUART_PRESC(FCK, BAUD))) ? \
+   USARTBAUD_LPUART_RAW(FCK, BAUD, USARTBAUD_LPUART_PRESC(FCK, BAUD)) : 0U)
+
+/* Error of the achieved rate NUM / DEN, in ppm of the requested rate; 0 when DEN = 0 */
+#define USARTBAUD_ERROR_PPM(NUM, DEN, BAUD) \
+  (((DEN) == 0U) ? 0 : \
+   (int32_t)((((int64_t)(NUM) * 1000000 / (int64_t)(((DEN) == 0U) ? 1U : (DEN))) - \
+              ((int64_t)(BAUD) * 1000000)) / (int64_t)(BAUD)))
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Register values for one baud rate.
+  */
+typedef struct
+{
+  uint32_t Brr;                          /*!< BRR value, 0 when unreachable      */
+  uint32_t Presc;                        /*!< PRESC value                        */
+  int32_t  ErrorPpm;                     /*!< Achieved rate error, ppm           */
+} USARTBAUD_EntryTypeDef;
+
+/**
+  * @brief Register values for all standard rates at one kernel clock.
+  */
+typedef struct
+{
+  uint32_t KernelClock;                  /*!< Kernel clock in Hz                 */
+  USARTBAUD_EntryTypeDef Entry[USARTBAUD_NB_RATES]; /*!< USARTBAUD_RATES order */
+} USARTBAUD_RowTypeDef;
+
+/**
+  * @brief Cache statistics.
+  */
+typedef struct
+{
+  uint32_t Lookups;                      /*!< Baud rates looked up               */
+  uint32_t Rebuilds;                     /*!< Kernel clock changes seen          */
+  uint32_t RowsComputed;                 /*!< Rebuilds without a precomputed row */
+  uint32_t Divisions;                    /*!< Non standard rates computed        */
+} USARTBAUD_StatsTypeDef;
+
+/**
+  * @brief Baud rate cache, one per USART / LPUART instance.
+  */
+typedef struct
+{
+  USART_TypeDef *Instance;               /*!< USART or LPUART instance          */
+
+  uint32_t IsLpuart;                     /*!< LPUART BRR format (internal)      */
+  uint32_t KernelClock;                  /*!< Clock of the cached row (internal) */
+  const USARTBAUD_RowTypeDef *Row;       /*!< Cached row, NULL when invalid (internal) */
+  USARTBAUD_RowTypeDef Computed;         /*!< Row built for an unlisted clock (internal) */
+  USARTBAUD_StatsTypeDef Stats;          /*!< Statistics                        */
+} USARTBAUD_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Exported_Functions
+  * @{
+  */
+
+ErrorStatus USARTBAUD_Init(USARTBAUD_HandleTypeDef *hbaud, USART_TypeDef *Instance);
+uint32_t    USARTBAUD_GetKernelClock(const USART_TypeDef *Instance);
+ErrorStatus USARTBAUD_Lookup(USARTBAUD_HandleTypeDef *hbaud, uint32_t Baud, USARTBAUD_EntryTypeDef *Entry);
+ErrorStatus USARTBAUD_Set(USARTBAUD_HandleTypeDef *hbaud, uint32_t Baud, int32_t *ErrorPpm);
+void        USARTBAUD_Invalidate(USARTBAUD_HandleTypeDef *hbaud);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_USART_BAUD_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
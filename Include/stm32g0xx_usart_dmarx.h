@@ -0,0 +1,166 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_dmarx.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx zero-copy USART receive header file.
+  *
+  *          The receiver runs a DMA channel in circular mode into a ring
+  *          buffer. Received data are handed to the application as spans,
+  *          i.e. pointers into the ring, never as copies, on:
+  *           - half transfer and transfer complete DMA events
+  *           - the receiver timeout (RTOR, USART_CR2_RTOEN), which closes a
+  *             frame after a programmable number of idle bit times, or the
+  *             idle line detection on instances without receiver timeout
+  *             (LPUART, basic USARTs)
+  *
+  *          A span stays valid until the DMA writes over it again, i.e. for
+  *          at least half a ring at the line rate. Spans crossing the end of
+  *          the ring are delivered as two calls. The USART and DMA interrupts
+  *          of a link must use the same priority.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_dmarx
+  * @{
+  */
+
+#ifndef STM32G0XX_USART_DMARX_H
+#define STM32G0XX_USART_DMARX_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_USART_DMARX_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMARX_Exported_Constants
+  * @{
+  */
+
+/** @defgroup USART_DMARX_Framing Frame end detection
+  * @{
+  */
+#define USARTRX_FRAMING_TIMEOUT        (0UL)  /*!< Receiver timeout, RTOR bit times */
+#define USARTRX_FRAMING_IDLE           (1UL)  /*!< Idle line, one character time    */
+/**
+  * @}
+  */
+
+/** @defgroup USART_DMARX_Event Span delivery reason
+  * @{
+  */
+#define USARTRX_EVENT_HALF             (0UL)  /*!< First half of the ring filled    */
+#define USARTRX_EVENT_FULL             (1UL)  /*!< Second half of the ring filled   */
+#define USARTRX_EVENT_FRAME            (2UL)  /*!< Receiver timeout or idle line    */
+#define USARTRX_EVENT_POLL             (3UL)  /*!< USARTRX_Poll() call              */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMARX_Exported_Types
+  * @{
+  */
+
+typedef struct USARTRX_Handle USARTRX_HandleTypeDef;
+
+/**
+  * @brief Span callback. Data points into the ring buffer.
+  */
+typedef void (*USARTRX_SpanCallbackTypeDef)(USARTRX_HandleTypeDef *hrx, const uint8_t *Data, uint32_t Length,
+                                            uint32_t Event);
+
+/**
+  * @brief Receiver statistics.
+  * @note  Interrupts * 1024 / Bytes gives the interrupt rate per KB, the CPU
+  *        load proxy of this receive mode.
+  */
+typedef struct
+{
+  uint32_t Bytes;                        /*!< Bytes delivered                    */
+  uint32_t Spans;                        /*!< Span callbacks                     */
+  uint32_t Frames;                       /*!< Receiver timeout / idle events     */
+  uint32_t Interrupts;                   /*!< USART and DMA interrupts served    */
+  uint32_t Overruns;                     /*!< USART overrun errors               */
+  uint32_t LineErrors;                   /*!< Framing, noise and parity errors   */
+  uint32_t DmaErrors;                    /*!< DMA transfer errors                */
+} USARTRX_StatsTypeDef;
+
+/**
+  * @brief Receiver handle.
+  */
+struct USARTRX_Handle
+{
+  USART_TypeDef *Instance;               /*!< USART or LPUART instance, baud rate
+                                              and frame format already set     */
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel                      */
+  uint32_t Request;                      /*!< DMAMUX_REQ_xx_RX                 */
+  uint8_t *Buffer;                       /*!< Ring buffer                      */
+  uint32_t Size;                         /*!< Ring size in bytes, even         */
+  uint32_t Framing;                      /*!< USARTRX_FRAMING_xx               */
+  uint32_t TimeoutBits;                  /*!< Receiver timeout, in bit times   */
+  USARTRX_SpanCallbackTypeDef SpanCallback; /*!< Span delivery                 */
+
+  uint32_t Tail;                         /*!< Next byte to deliver (internal)  */
+  USARTRX_StatsTypeDef Stats;            /*!< Statistics                       */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMARX_Exported_Functions
+  * @{
+  */
+
+ErrorStatus USARTRX_Init(USARTRX_HandleTypeDef *hrx);
+void        USARTRX_Start(USARTRX_HandleTypeDef *hrx);
+void        USARTRX_Stop(USARTRX_HandleTypeDef *hrx);
+void        USARTRX_Poll(USARTRX_HandleTypeDef *hrx);
+void        USARTRX_USART_IRQHandler(USARTRX_HandleTypeDef *hrx);
+void        USARTRX_DMA_IRQHandler(USARTRX_HandleTypeDef *hrx);
+void        USARTRX_FlagsHandler(void *Context, uint32_t Flags);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_USART_DMARX_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
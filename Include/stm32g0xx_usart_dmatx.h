@@ -0,0 +1,179 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_dmatx.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx scatter-gather USART transmit queue header file.
+  *
+  *          Frames are queued as arrays of fragments (base, length) and are
+  *          not copied: each fragment becomes one DMA segment, loaded into
+  *          CMAR/CNDTR from the transfer complete interrupt of the previous
+  *          one, so a burst of frames costs one DMA setup and one interrupt
+  *          per segment instead of per frame and per call.
+  *
+  *          Adjacent fragments shorter than CoalesceThreshold are copied into
+  *          a bounce ring and sent as a single segment, which avoids paying a
+  *          segment switch for a 2 byte header or checksum. Completed frames
+  *          are reported in batches of up to BatchFrames, or when the queue
+  *          runs empty.
+  *
+  *          Fragment data must stay unchanged until their frame is reported
+  *          complete. Completion means the last byte was handed to the USART,
+  *          not that it left the line.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_dmatx
+  * @{
+  */
+
+#ifndef STM32G0XX_USART_DMATX_H
+#define STM32G0XX_USART_DMATX_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_USART_DMATX_Includes
+  * @{
+  */
+#include "stm32g0xx_dma_util.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMATX_Exported_Constants
+  * @{
+  */
+
+#define USARTTX_SEGMENT_MAX            (0xFFFFUL)  /*!< Longest DMA segment, CNDTR limit */
+#define USARTTX_SEG_END_OF_FRAME       (0x0001U)   /*!< Segment closes a frame           */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMATX_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief Frame fragment.
+  */
+typedef struct
+{
+  const uint8_t *Data;                   /*!< Fragment start                     */
+  uint32_t Length;                       /*!< Fragment length in bytes           */
+} USARTTX_IovecTypeDef;
+
+/**
+  * @brief Queued DMA segment, owned by the queue.
+  */
+typedef struct
+{
+  const uint8_t *Data;                   /*!< Loaded into CMAR                   */
+  uint16_t Length;                       /*!< Loaded into CNDTR                  */
+  uint16_t Flags;                        /*!< USARTTX_SEG_xx                     */
+  uint32_t Bounce;                       /*!< Bounce ring bytes released on completion,
+                                              padding included                   */
+} USARTTX_SegmentTypeDef;
+
+/**
+  * @brief Transmit queue statistics.
+  * @note  Segments / Frames is the average number of DMA reloads per frame;
+  *        Interrupts / Callbacks is the batching factor.
+  */
+typedef struct
+{
+  uint32_t Frames;                       /*!< Completed frames                   */
+  uint32_t Fragments;                    /*!< Fragments accepted                 */
+  uint32_t Segments;                     /*!< Completed DMA segments             */
+  uint32_t CoalescedBytes;               /*!< Bytes copied into the bounce ring  */
+  uint32_t Rejected;                     /*!< USARTTX_Send() calls refused       */
+  uint32_t Interrupts;                   /*!< DMA interrupts served              */
+  uint32_t Callbacks;                    /*!< Completion callbacks               */
+  uint32_t Errors;                       /*!< DMA transfer errors                */
+} USARTTX_StatsTypeDef;
+
+typedef struct USARTTX_Handle USARTTX_HandleTypeDef;
+
+/**
+  * @brief Batched completion callback, Frames oldest queued frames are done.
+  */
+typedef void (*USARTTX_CompleteCallbackTypeDef)(USARTTX_HandleTypeDef *htx, uint32_t Frames);
+
+/**
+  * @brief Transmit queue handle.
+  */
+struct USARTTX_Handle
+{
+  USART_TypeDef *Instance;               /*!< USART or LPUART instance, baud rate
+                                              and frame format already set      */
+  DMA_Channel_TypeDef *Channel;          /*!< DMA channel                       */
+  uint32_t Request;                      /*!< DMAMUX_REQ_xx_TX                  */
+  USARTTX_SegmentTypeDef *Segments;      /*!< Segment ring                      */
+  uint32_t NbSegments;                   /*!< Segment ring size, power of two   */
+  uint8_t *Bounce;                       /*!< Bounce ring, NULL disables coalescing */
+  uint32_t BounceSize;                   /*!< Bounce ring size, power of two    */
+  uint32_t CoalesceThreshold;            /*!< Fragments shorter than this are copied */
+  uint32_t BatchFrames;                  /*!< Frames per callback, 0 reports only
+                                              when the queue runs empty         */
+  USARTTX_CompleteCallbackTypeDef CompleteCallback; /*!< Batched completion     */
+
+  volatile uint32_t SegHead;             /*!< Next free segment (internal)      */
+  volatile uint32_t SegTail;             /*!< Segment in transfer (internal)    */
+  uint32_t BounceHead;                   /*!< Next free bounce byte (internal)  */
+  volatile uint32_t BounceTail;          /*!< Oldest used bounce byte (internal) */
+  volatile uint32_t Busy;                /*!< DMA channel running (internal)    */
+  volatile uint32_t Failed;              /*!< Stopped on a DMA error (internal) */
+  uint32_t PendingFrames;                /*!< Frames not yet reported (internal) */
+  USARTTX_StatsTypeDef Stats;            /*!< Statistics                        */
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMATX_Exported_Functions
+  * @{
+  */
+
+ErrorStatus USARTTX_Init(USARTTX_HandleTypeDef *htx);
+ErrorStatus USARTTX_Send(USARTTX_HandleTypeDef *htx, const USARTTX_IovecTypeDef *Iov, uint32_t Count);
+uint32_t    USARTTX_IsIdle(const USARTTX_HandleTypeDef *htx);
+void        USARTTX_IRQHandler(USARTTX_HandleTypeDef *htx);
+void        USARTTX_FlagsHandler(void *Context, uint32_t Flags);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_USART_DMATX_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,164 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_fifo.h
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx USART FIFO mode driver header file.
+  *
+  *          The full featured USARTs and the LPUARTs embed 8 deep transmit
+  *          and receive FIFOs (USART_CR1_FIFOEN). In FIFO mode this driver
+  *          takes one interrupt per threshold crossing instead of one per
+  *          byte:
+  *           - RXFT: the receive FIFO reached the RXFTCFG threshold, it is
+  *             drained into a software ring
+  *           - TXFT: the transmit FIFO fell to the TXFTCFG threshold, it is
+  *             refilled from a software ring
+  *           - receiver timeout or idle line: bytes left below the receive
+  *             threshold at the end of a burst are drained
+  *
+  *          With full thresholds this divides the interrupt rate by up to 8
+  *          on links that cannot spare a DMA channel. Basic USARTs without
+  *          FIFO, e.g. USART3 and USART4 on STM32G07x, are rejected by
+  *          USARTFIFO_Init().
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_fifo
+  * @{
+  */
+
+#ifndef STM32G0XX_USART_FIFO_H
+#define STM32G0XX_USART_FIFO_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/** @addtogroup STM32G0xx_USART_FIFO_Includes
+  * @{
+  */
+#include "stm32g0xx.h"
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_FIFO_Exported_Constants
+  * @{
+  */
+
+/** @defgroup USART_FIFO_Threshold FIFO thresholds (RXFTCFG / TXFTCFG encoding)
+  * @{
+  */
+#define USARTFIFO_THRESHOLD_1_8        (0UL)   /*!< 1 byte               */
+#define USARTFIFO_THRESHOLD_1_4        (1UL)   /*!< 2 bytes              */
+#define USARTFIFO_THRESHOLD_1_2        (2UL)   /*!< 4 bytes              */
+#define USARTFIFO_THRESHOLD_3_4        (3UL)   /*!< 6 bytes              */
+#define USARTFIFO_THRESHOLD_7_8        (4UL)   /*!< 7 bytes              */
+#define USARTFIFO_THRESHOLD_8_8        (5UL)   /*!< 8 bytes, FIFO full   */
+/**
+  * @}
+  */
+
+#define USARTFIFO_DEPTH                (8UL)   /*!< Hardware FIFO depth  */
+
+/** @defgroup USART_FIFO_Framing End of burst detection
+  * @{
+  */
+#define USARTFIFO_FRAMING_TIMEOUT      (0UL)   /*!< Receiver timeout, not on LPUART */
+#define USARTFIFO_FRAMING_IDLE         (1UL)   /*!< Idle line                       */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_FIFO_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief FIFO driver statistics.
+  * @note  Interrupts * 1024 / (RxBytes + TxBytes) gives interrupts per KB.
+  */
+typedef struct
+{
+  uint32_t Interrupts;                   /*!< USART interrupts served            */
+  uint32_t RxBytes;                      /*!< Bytes read from the receive FIFO   */
+  uint32_t TxBytes;                      /*!< Bytes written to the transmit FIFO */
+  uint32_t RxDropped;                    /*!< Bytes lost on a full software ring */
+  uint32_t Overruns;                     /*!< Hardware overrun errors            */
+} USARTFIFO_StatsTypeDef;
+
+/**
+  * @brief FIFO driver handle.
+  * @note  Ring sizes must be powers of two.
+  */
+typedef struct
+{
+  USART_TypeDef *Instance;               /*!< USART or LPUART instance, baud rate
+                                              and frame format already set      */
+  uint32_t RxThreshold;                  /*!< USARTFIFO_THRESHOLD_xx            */
+  uint32_t TxThreshold;                  /*!< USARTFIFO_THRESHOLD_xx            */
+  uint32_t Framing;                      /*!< USARTFIFO_FRAMING_xx              */
+  uint32_t TimeoutBits;                  /*!< Receiver timeout, in bit times    */
+  uint8_t *RxBuffer;                     /*!< Receive ring                      */
+  uint32_t RxSize;                       /*!< Receive ring size                 */
+  uint8_t *TxBuffer;                     /*!< Transmit ring                     */
+  uint32_t TxSize;                       /*!< Transmit ring size                */
+
+  volatile uint32_t RxHead;              /*!< Written by the interrupt (internal) */
+  volatile uint32_t RxTail;              /*!< Written by USARTFIFO_Read (internal) */
+  volatile uint32_t TxHead;              /*!< Written by USARTFIFO_Write (internal) */
+  volatile uint32_t TxTail;              /*!< Written by the interrupt (internal) */
+  USARTFIFO_StatsTypeDef Stats;          /*!< Statistics                        */
+} USARTFIFO_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_FIFO_Exported_Functions
+  * @{
+  */
+
+ErrorStatus USARTFIFO_Init(USARTFIFO_HandleTypeDef *hfifo);
+uint32_t    USARTFIFO_Write(USARTFIFO_HandleTypeDef *hfifo, const uint8_t *Data, uint32_t Length);
+uint32_t    USARTFIFO_Read(USARTFIFO_HandleTypeDef *hfifo, uint8_t *Data, uint32_t Length);
+uint32_t    USARTFIFO_GetRxCount(const USARTFIFO_HandleTypeDef *hfifo);
+void        USARTFIFO_IRQHandler(USARTFIFO_HandleTypeDef *hfifo);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32G0XX_USART_FIFO_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
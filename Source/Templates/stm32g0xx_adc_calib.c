@@ -0,0 +1,261 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_adc_calib.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx ADC calibrated conversions.
+  *
+  *   This file provides:
+  *      - ADCCAL_Init(): loads the calibration words and precomputes the
+  *                       constant scale factors.
+  *
+  *      - ADCCAL_SetVrefint(): VDDA from a VREFINT reading, refreshes the
+  *                             per-code factors.
+  *
+  *      - ADCCAL_ToMillivolts() / ADCCAL_ToCentidegrees(): conversions of a
+  *                                                         raw code.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_adc_calib
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_ADC_Calib_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_adc_calib.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Calib_Private_Defines
+  * @{
+  */
+
+#define ADCCAL_BITS_MIN                (12UL)
+#define ADCCAL_BITS_MAX                (16UL)
+#define ADCCAL_CODE_MAX                (0xFFFUL)
+#define ADCCAL_SLOPE_MIN_UV            (1000UL)
+#define ADCCAL_SLOPE_MAX_UV            (10000UL)
+
+/* Reciprocal: 2^46 / x for x normalized to [2^15, 2^16) */
+#define ADCCAL_RECIP_SHIFT             (46U)
+#define ADCCAL_RECIP_ITERATIONS        (3UL)
+
+/* Linear seed 48/17 - 32/17 * x, x in [0.5, 1), in Q30 */
+#define ADCCAL_SEED_C1                 (3031741621UL)
+#define ADCCAL_SEED_C2                 (2021161080UL)
+
+/* Fraction bits of InvSlope, TsBias and TsScale */
+#define ADCCAL_TEMP_SHIFT              (12U)
+
+/* Offset keeping the temperature sum unsigned, 2^31 in Q12 centidegrees */
+#define ADCCAL_TEMP_BIAS               (0x80000000UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Calib_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Newton-Raphson reciprocal, multiplications only.
+  * @note   Each iteration squares the relative error, 1/17 for the seed.
+  * @param  X value in [2^15, 2^16)
+  * @retval 2^46 / X, rounded down within 2 units
+  */
+static uint32_t ADCCAL_Reciprocal(uint32_t X)
+{
+  const uint64_t one = (uint64_t)1U << ADCCAL_RECIP_SHIFT;
+  uint64_t product;
+  uint32_t y;
+  uint32_t i;
+
+  y = ADCCAL_SEED_C1 - (uint32_t)(((uint64_t)ADCCAL_SEED_C2 * X) >> 16U);
+
+  /* y += y * (1 - X * y), each term kept unsigned */
+  for (i = 0UL; i < ADCCAL_RECIP_ITERATIONS; i++)
+  {
+    product = (uint64_t)X * y;
+    if (product <= one)
+    {
+      y += (uint32_t)(((uint64_t)y * ((one - product) >> 16U)) >> 30U);
+    }
+    else
+    {
+      y -= (uint32_t)(((uint64_t)y * ((product - one) >> 16U)) >> 30U);
+    }
+  }
+
+  return y;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Calib_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Load the calibration words and precompute the scale factors.
+  * @note   The only divisions of the module are here. VDDA is taken as
+  *         3.0 V until the first ADCCAL_SetVrefint().
+  * @param  hcal conversion handle
+  * @retval SUCCESS, or ERROR on an invalid configuration or a blank
+  *         calibration word
+  */
+ErrorStatus ADCCAL_Init(ADCCAL_HandleTypeDef *hcal)
+{
+  uint32_t extra;
+  uint64_t offset;
+
+  if ((hcal == NULL) || (hcal->ResultBits < ADCCAL_BITS_MIN) || (hcal->ResultBits > ADCCAL_BITS_MAX))
+  {
+    return ERROR;
+  }
+
+  if (hcal->VrefintCal == 0UL)
+  {
+    hcal->VrefintCal = *ADCCAL_VREFINT_CAL_ADDR;
+  }
+  if (hcal->TsCal1 == 0UL)
+  {
+    hcal->TsCal1 = *ADCCAL_TS_CAL1_ADDR;
+  }
+  if (hcal->AvgSlope == 0UL)
+  {
+    hcal->AvgSlope = ADCCAL_AVG_SLOPE_UV;
+  }
+  if ((hcal->VrefintCal == 0UL) || (hcal->VrefintCal > ADCCAL_CODE_MAX) ||
+      (hcal->TsCal1 == 0UL) || (hcal->TsCal1 > ADCCAL_CODE_MAX) ||
+      (hcal->AvgSlope < ADCCAL_SLOPE_MIN_UV) || (hcal->AvgSlope > ADCCAL_SLOPE_MAX_UV))
+  {
+    return ERROR;
+  }
+
+  /* Codes above 12 bits: full scale is 4095 << extra */
+  extra = hcal->ResultBits - ADCCAL_BITS_MIN;
+
+  /* VDDA = VrefNum / VREFINT code */
+  hcal->VrefNum = ADCCAL_CAL_VDDA_MV * (hcal->VrefintCal << extra);
+
+  /* mV per code, Q(16 + extra) = CodeNum / VREFINT code */
+  hcal->CodeNum = (uint32_t)((((uint64_t)ADCCAL_CAL_VDDA_MV * hcal->VrefintCal) << (16U + extra)) /
+                             ADCCAL_CODE_MAX);
+
+  /* Centidegrees per mV, and TS_CAL1 in centidegrees, Q12 */
+  hcal->InvSlope = ((100000UL << ADCCAL_TEMP_SHIFT) + (hcal->AvgSlope / 2UL)) / hcal->AvgSlope;
+  offset = (((uint64_t)hcal->TsCal1 * ADCCAL_CAL_VDDA_MV * hcal->InvSlope) + (ADCCAL_CODE_MAX / 2UL)) / ADCCAL_CODE_MAX;
+  if (offset >= ADCCAL_TEMP_BIAS)
+  {
+    return ERROR;
+  }
+  hcal->TsBias = ADCCAL_TEMP_BIAS + (1UL << (ADCCAL_TEMP_SHIFT - 1U)) - (uint32_t)offset;
+
+  (void)ADCCAL_SetVrefint(hcal, hcal->VrefintCal << extra);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Take a VREFINT reading into account.
+  * @note   Readings for a VDDA outside 1.5 V to 4.0 V are rejected, the
+  *         previous factors are then kept.
+  * @param  hcal conversion handle
+  * @param  Raw VREFINT code, ResultBits wide
+  * @retval VDDA in mV, 0 for a rejected reading
+  */
+uint32_t ADCCAL_SetVrefint(ADCCAL_HandleTypeDef *hcal, uint32_t Raw)
+{
+  uint32_t extra = hcal->ResultBits - ADCCAL_BITS_MIN;
+  uint32_t cal = hcal->VrefintCal << extra;
+  uint32_t x = Raw;
+  uint32_t shift = ADCCAL_RECIP_SHIFT;
+  uint32_t recip;
+
+  /* VDDA = 3.0 V * cal / Raw */
+  if ((Raw < (cal - (cal >> 2U))) || (Raw > (2UL * cal)))
+  {
+    return 0UL;
+  }
+
+  /* 1 / Raw = recip / 2^shift */
+  while (x < 0x8000UL)
+  {
+    x <<= 1U;
+    shift--;
+  }
+  recip = ADCCAL_Reciprocal(x);
+
+  hcal->Vdda = (uint32_t)((((uint64_t)hcal->VrefNum * recip) + ((uint64_t)1U << (shift - 1U))) >> shift);
+  hcal->MvPerCode = (uint32_t)((((uint64_t)hcal->CodeNum * recip) + ((uint64_t)1U << (shift - 1U))) >> shift);
+  hcal->TsScale = (uint32_t)((((uint64_t)hcal->MvPerCode * hcal->InvSlope) + ((uint64_t)1U << (15U + extra))) >>
+                             (16U + extra));
+
+  return hcal->Vdda;
+}
+
+/**
+  * @brief  Convert a code to millivolts at the last VDDA.
+  * @param  hcal conversion handle
+  * @param  Raw code, ResultBits wide, at most full scale
+  * @retval Voltage in mV, rounded
+  */
+uint32_t ADCCAL_ToMillivolts(const ADCCAL_HandleTypeDef *hcal, uint32_t Raw)
+{
+  uint32_t shift = 16UL + (hcal->ResultBits - ADCCAL_BITS_MIN);
+
+  return ((Raw * hcal->MvPerCode) + (1UL << (shift - 1UL))) >> shift;
+}
+
+/**
+  * @brief  Convert a temperature sensor code to centidegrees Celsius.
+  * @note   Uses the single point TS_CAL1 and AvgSlope. The resolution is
+  *         0.01 degC, the accuracy that of the sensor.
+  * @param  hcal conversion handle
+  * @param  Raw temperature sensor code, ResultBits wide
+  * @retval Temperature in 0.01 degC, rounded
+  */
+int32_t ADCCAL_ToCentidegrees(const ADCCAL_HandleTypeDef *hcal, uint32_t Raw)
+{
+  uint32_t sum = (Raw * hcal->TsScale) + hcal->TsBias;
+
+  return (int32_t)(sum >> ADCCAL_TEMP_SHIFT) - (int32_t)(ADCCAL_TEMP_BIAS >> ADCCAL_TEMP_SHIFT) + ADCCAL_TS_CAL1_CENTIDEG;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
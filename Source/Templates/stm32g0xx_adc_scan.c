@@ -0,0 +1,555 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_adc_scan.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx ADC continuous scan pipeline.
+  *
+  *   This file provides:
+  *      - ADCSCAN_GetAdcClock(): ADC clock, read from the clock mode, the
+  *                               RCC selection and the common prescaler.
+  *
+  *      - ADCSCAN_Init() / Start() / Stop(): calibration, continuous scan
+  *                                           with hardware oversampling and
+  *                                           circular DMA setup.
+  *
+  *      - ADCSCAN_FlagsHandler(): half and full events, hands the released
+  *                                frames to the callback and checks its
+  *                                deadline.
+  *
+  *      - ADCSCAN_ADC_IRQHandler(): overrun recovery.
+  *
+  *      - ADCSCAN_GetSampleRate() / GetReport(): expected and sustained
+  *                                               result rates, CPU load.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_adc_scan
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_adc_scan.h"
+#include "stm32g0xx_dmamux_route.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Private_Defines
+  * @{
+  */
+
+#if !defined  (HSE_VALUE)
+  #define HSE_VALUE  (8000000UL)    /*!< Value of the External oscillator in Hz */
+#endif /* HSE_VALUE */
+
+#if !defined  (HSI_VALUE)
+  #define HSI_VALUE  (16000000UL)   /*!< Value of the Internal oscillator in Hz*/
+#endif /* HSI_VALUE */
+
+/* ADCSEL encoding */
+#define ADCSCAN_SEL_SYSCLK             (0UL)
+#define ADCSCAN_SEL_PLLP               (1UL)
+#define ADCSCAN_SEL_HSI16              (2UL)
+
+/* CKMODE encoding */
+#define ADCSCAN_CKMODE_ASYNC           (0UL)
+#define ADCSCAN_CKMODE_PCLK_DIV2       (1UL)
+#define ADCSCAN_CKMODE_PCLK_DIV4       (2UL)
+
+/* Voltage regulator start-up time, tADCVREG_STUP */
+#define ADCSCAN_VREG_STARTUP_US        (20UL)
+
+/* Successive approximation time at 12 bits, in half ADC clock cycles */
+#define ADCSCAN_SAR_HALF_CYCLES        (25UL)
+
+#define ADCSCAN_SMP_MAX                (7UL)
+#define ADCSCAN_SHIFT_MAX              (8UL)
+#define ADCSCAN_HALF_MAX               (DMA_CNDTR_NDT / 2UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Private_Variables
+  * @{
+  */
+
+/* ADC_CCR PRESC divider */
+static const uint16_t ADCSCAN_Presc[16] =
+{
+  1U, 2U, 4U, 6U, 8U, 10U, 12U, 16U, 32U, 64U, 128U, 256U, 256U, 256U, 256U, 256U
+};
+
+/* Sampling time per SMP value, in half ADC clock cycles */
+static const uint16_t ADCSCAN_SmpHalfCycles[ADCSCAN_SMP_MAX + 1UL] =
+{
+  3U, 7U, 15U, 25U, 39U, 79U, 159U, 321U
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  PLL "P" output frequency.
+  * @retval Frequency in Hz, 0 when the output is disabled
+  */
+static uint32_t ADCSCAN_GetPllpClock(void)
+{
+  uint32_t pllcfgr = RCC->PLLCFGR;
+  uint32_t pllvco;
+  uint32_t pllm;
+  uint32_t pllp;
+
+  if ((pllcfgr & RCC_PLLCFGR_PLLPEN) == 0UL)
+  {
+    return 0UL;
+  }
+
+  pllm = ((pllcfgr & RCC_PLLCFGR_PLLM) >> RCC_PLLCFGR_PLLM_Pos) + 1UL;
+  if ((pllcfgr & RCC_PLLCFGR_PLLSRC) == 0x03UL) /* HSE used as PLL clock source */
+  {
+    pllvco = (HSE_VALUE / pllm);
+  }
+  else if ((pllcfgr & RCC_PLLCFGR_PLLSRC) == 0x02UL) /* HSI used as PLL clock source */
+  {
+    pllvco = (HSI_VALUE / pllm);
+  }
+  else
+  {
+    return 0UL;
+  }
+  pllvco = pllvco * ((pllcfgr & RCC_PLLCFGR_PLLN) >> RCC_PLLCFGR_PLLN_Pos);
+  pllp = ((pllcfgr & RCC_PLLCFGR_PLLP) >> RCC_PLLCFGR_PLLP_Pos) + 1UL;
+
+  return pllvco / pllp;
+}
+
+/**
+  * @brief  Busy wait of at least the given time at SystemCoreClock.
+  * @param  Microseconds time to wait
+  * @retval None
+  */
+static void ADCSCAN_Delay(uint32_t Microseconds)
+{
+  volatile uint32_t count = ((SystemCoreClock / 1000000UL) + 1UL) * Microseconds;
+
+  while (count != 0UL)
+  {
+    count--;
+  }
+}
+
+/**
+  * @brief  Stop the conversions and rewind the DMA to the first half.
+  * @param  hscan pipeline handle
+  * @retval None
+  */
+static void ADCSCAN_Halt(ADCSCAN_HandleTypeDef *hscan)
+{
+  ADC_TypeDef *adc = hscan->Instance;
+
+  if ((adc->CR & ADC_CR_ADSTART) != 0UL)
+  {
+    SET_BIT(adc->CR, ADC_CR_ADSTP);
+    while ((adc->CR & ADC_CR_ADSTART) != 0UL)
+    {
+    }
+  }
+  CLEAR_BIT(hscan->Channel->CCR, DMA_CCR_EN);
+  DMA_UTIL_ClearFlags(hscan->Channel, DMA_UTIL_FLAG_ALL);
+  hscan->Channel->CNDTR = 2UL * hscan->HalfSamples;
+}
+
+/**
+  * @brief  Hand a filled half to the callback.
+  * @param  hscan pipeline handle
+  * @param  Half 0 for the first half, 1 for the second
+  * @retval None
+  */
+static void ADCSCAN_Deliver(ADCSCAN_HandleTypeDef *hscan, uint32_t Half)
+{
+  uint32_t start = DMA_UTIL_CycleStamp();
+  uint32_t position;
+  uint32_t cycles;
+
+  hscan->Callback(hscan, &hscan->Buffer[Half * hscan->HalfSamples], hscan->FramesPerHalf);
+
+  cycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+  hscan->Stats.Halves++;
+  hscan->Stats.Frames += hscan->FramesPerHalf;
+  hscan->Stats.LastCycles = cycles;
+  hscan->Stats.TotalCycles += cycles;
+  if (cycles > hscan->Stats.MaxCycles)
+  {
+    hscan->Stats.MaxCycles = cycles;
+  }
+
+  /* The DMA must still be in the other half */
+  position = (2UL * hscan->HalfSamples) - (hscan->Channel->CNDTR & DMA_CNDTR_NDT);
+  if ((position >= hscan->HalfSamples) != (Half == 0UL))
+  {
+    hscan->Stats.Late++;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Scan_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Get the clock of an ADC.
+  * @note   HCLK and SYSCLK are taken as SystemCoreClock, which must be up to
+  *         date.
+  * @param  Instance ADC instance
+  * @retval Frequency in Hz, 0 for a disabled PLL output
+  */
+uint32_t ADCSCAN_GetAdcClock(const ADC_TypeDef *Instance)
+{
+  uint32_t ckmode = (Instance->CFGR2 & ADC_CFGR2_CKMODE) >> ADC_CFGR2_CKMODE_Pos;
+  uint32_t pclk = SystemCoreClock >> APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE) >> RCC_CFGR_PPRE_Pos];
+  uint32_t clock;
+
+  switch (ckmode)
+  {
+    case ADCSCAN_CKMODE_ASYNC:
+      break;
+
+    case ADCSCAN_CKMODE_PCLK_DIV2:
+      return pclk / 2UL;
+
+    case ADCSCAN_CKMODE_PCLK_DIV4:
+      return pclk / 4UL;
+
+    default:
+      return pclk;
+  }
+
+  switch ((RCC->CCIPR & RCC_CCIPR_ADCSEL) >> RCC_CCIPR_ADCSEL_Pos)
+  {
+    case ADCSCAN_SEL_SYSCLK:
+      clock = SystemCoreClock;
+      break;
+
+    case ADCSCAN_SEL_PLLP:
+      clock = ADCSCAN_GetPllpClock();
+      break;
+
+    case ADCSCAN_SEL_HSI16:
+      clock = HSI_VALUE;
+      break;
+
+    default:
+      clock = 0UL;
+      break;
+  }
+
+  return clock / ADCSCAN_Presc[(ADC1_COMMON->CCR & ADC_CCR_PRESC) >> ADC_CCR_PRESC_Pos];
+}
+
+/**
+  * @brief  Calibrate and enable the ADC, left with the scan not started.
+  * @note   12-bit right aligned results, software start. The ADC is
+  *         disabled first if needed; CKMODE and the common prescaler are
+  *         kept.
+  * @param  hscan pipeline handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus ADCSCAN_Init(ADCSCAN_HandleTypeDef *hscan)
+{
+  ADC_TypeDef *adc;
+  DMA_Channel_TypeDef *channel;
+  uint32_t cfgr2;
+  uint32_t mask;
+
+  if ((hscan == NULL) || (hscan->Instance == NULL) || (hscan->Channel == NULL) ||
+      (hscan->Buffer == NULL) || (hscan->Callback == NULL) || (hscan->FramesPerHalf == 0UL) ||
+      (hscan->Channels == 0UL) || ((hscan->Channels & ~ADC_CHSELR_CHSEL) != 0UL) ||
+      (hscan->SamplingTime > ADCSCAN_SMP_MAX) || (hscan->Shift > ADCSCAN_SHIFT_MAX) ||
+      ((hscan->Oversampling != ADCSCAN_OVS_NONE) && (hscan->Oversampling > ADCSCAN_OVS_256)) ||
+      ((hscan->Priority & ~DMA_CCR_PL) != 0UL))
+  {
+    return ERROR;
+  }
+
+  hscan->NbChannels = 0UL;
+  for (mask = hscan->Channels; mask != 0UL; mask &= mask - 1UL)
+  {
+    hscan->NbChannels++;
+  }
+  if (hscan->FramesPerHalf > (ADCSCAN_HALF_MAX / hscan->NbChannels))
+  {
+    return ERROR;
+  }
+  hscan->HalfSamples = hscan->FramesPerHalf * hscan->NbChannels;
+
+  adc = hscan->Instance;
+  channel = hscan->Channel;
+
+  /* ADC: back to disabled, the configuration registers are then writable */
+  adc->IER = 0UL;
+  if ((adc->CR & ADC_CR_ADSTART) != 0UL)
+  {
+    SET_BIT(adc->CR, ADC_CR_ADSTP);
+    while ((adc->CR & ADC_CR_ADSTART) != 0UL)
+    {
+    }
+  }
+  if ((adc->CR & ADC_CR_ADEN) != 0UL)
+  {
+    SET_BIT(adc->CR, ADC_CR_ADDIS);
+    while ((adc->CR & ADC_CR_ADEN) != 0UL)
+    {
+    }
+  }
+
+  /* Regulator, then calibration with DMA requests off */
+  if ((adc->CR & ADC_CR_ADVREGEN) == 0UL)
+  {
+    SET_BIT(adc->CR, ADC_CR_ADVREGEN);
+    ADCSCAN_Delay(ADCSCAN_VREG_STARTUP_US);
+  }
+  adc->CFGR1 = 0UL;
+  SET_BIT(adc->CR, ADC_CR_ADCAL);
+  while ((adc->CR & ADC_CR_ADCAL) != 0UL)
+  {
+  }
+
+  /* Continuous scan, DMA circular mode, conversions held on overrun */
+  adc->CFGR1 = ADC_CFGR1_CONT | ADC_CFGR1_DMAEN | ADC_CFGR1_DMACFG;
+  cfgr2 = adc->CFGR2 & ADC_CFGR2_CKMODE;
+  if (hscan->Oversampling != ADCSCAN_OVS_NONE)
+  {
+    cfgr2 |= ADC_CFGR2_OVSE | (hscan->Oversampling << ADC_CFGR2_OVSR_Pos) |
+             (hscan->Shift << ADC_CFGR2_OVSS_Pos);
+  }
+  adc->CFGR2 = cfgr2;
+  adc->SMPR = hscan->SamplingTime << ADC_SMPR_SMP1_Pos;
+
+  /* Enable: ADEN may be ignored right after calibration, so it is repeated */
+  adc->ISR = ADC_ISR_ADRDY;
+  while ((adc->ISR & ADC_ISR_ADRDY) == 0UL)
+  {
+    if ((adc->CR & ADC_CR_ADEN) == 0UL)
+    {
+      SET_BIT(adc->CR, ADC_CR_ADEN);
+    }
+  }
+
+  /* Channel set, applied once CCRDY is up */
+  adc->ISR = ADC_ISR_CCRDY;
+  adc->CHSELR = hscan->Channels;
+  while ((adc->ISR & ADC_ISR_CCRDY) == 0UL)
+  {
+  }
+  adc->ISR = ADC_ISR_CCRDY | ADC_ISR_OVR | ADC_ISR_EOC | ADC_ISR_EOS;
+  adc->IER = ADC_IER_OVRIE;
+
+  /* DMA: half-words from DR, circular over both halves */
+  DMA_UTIL_EnableClock(channel);
+  channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(channel)->CCR = (DMAMUX_REQ_ADC1 << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  channel->CPAR = (uint32_t)&adc->DR;
+  channel->CMAR = (uint32_t)hscan->Buffer;
+  channel->CNDTR = 2UL * hscan->HalfSamples;
+  channel->CCR = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 |
+                 DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_TEIE | hscan->Priority;
+
+  ADCSCAN_ResetStats(hscan);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start the scan at the first selected channel.
+  * @param  hscan pipeline handle
+  * @retval None
+  */
+void ADCSCAN_Start(ADCSCAN_HandleTypeDef *hscan)
+{
+  ADC_TypeDef *adc = hscan->Instance;
+
+  SET_BIT(hscan->Channel->CCR, DMA_CCR_EN);
+  adc->ISR = ADC_ISR_OVR | ADC_ISR_EOC | ADC_ISR_EOS;
+  SET_BIT(adc->CR, ADC_CR_ADSTART);
+}
+
+/**
+  * @brief  Stop the scan; the ADC stays enabled.
+  * @note   The frames of the half in progress are dropped.
+  * @param  hscan pipeline handle
+  * @retval None
+  */
+void ADCSCAN_Stop(ADCSCAN_HandleTypeDef *hscan)
+{
+  ADCSCAN_Halt(hscan);
+}
+
+/**
+  * @brief  Compute the expected result rate of one channel set.
+  * @note   Each result takes the oversampling ratio times the sampling time
+  *         plus 12.5 ADC clock cycles; the sequence runs back to back.
+  * @param  hscan pipeline handle, initialized
+  * @retval Results per second, 0 when the ADC clock is unknown
+  */
+uint32_t ADCSCAN_GetSampleRate(const ADCSCAN_HandleTypeDef *hscan)
+{
+  uint32_t half_cycles = (uint32_t)ADCSCAN_SmpHalfCycles[hscan->SamplingTime] + ADCSCAN_SAR_HALF_CYCLES;
+
+  if (hscan->Oversampling != ADCSCAN_OVS_NONE)
+  {
+    half_cycles <<= hscan->Oversampling + 1UL;
+  }
+
+  return (uint32_t)(((uint64_t)ADCSCAN_GetAdcClock(hscan->Instance) * 2U) / half_cycles);
+}
+
+/**
+  * @brief  Handle the ADC interrupt.
+  * @note   An overrun has stopped the DMA requests: the scan is restarted
+  *         from the first channel and the first half of the buffer.
+  * @param  hscan pipeline handle
+  * @retval None
+  */
+void ADCSCAN_ADC_IRQHandler(ADCSCAN_HandleTypeDef *hscan)
+{
+  if ((hscan->Instance->ISR & ADC_ISR_OVR) != 0UL)
+  {
+    hscan->Stats.Overruns++;
+    ADCSCAN_Halt(hscan);
+    ADCSCAN_Start(hscan);
+  }
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  hscan pipeline handle
+  * @retval None
+  */
+void ADCSCAN_DMA_IRQHandler(ADCSCAN_HandleTypeDef *hscan)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hscan->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_HT | DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hscan->Channel, flags);
+    ADCSCAN_FlagsHandler(hscan, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context pipeline handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void ADCSCAN_FlagsHandler(void *Context, uint32_t Flags)
+{
+  ADCSCAN_HandleTypeDef *hscan = (ADCSCAN_HandleTypeDef *)Context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hscan->Stats.DmaErrors++;
+    return;
+  }
+  if ((Flags & DMA_UTIL_FLAG_HT) != 0UL)
+  {
+    ADCSCAN_Deliver(hscan, 0UL);
+  }
+  if ((Flags & DMA_UTIL_FLAG_TC) != 0UL)
+  {
+    ADCSCAN_Deliver(hscan, 1UL);
+  }
+}
+
+/**
+  * @brief  Report the throughput since the statistics were reset.
+  * @note   Run the pipeline for 1 to 8 channels in turn to compare the
+  *         sustained rate with the expected one, and the load it costs.
+  *         The load counts the callback only, not the interrupt entry.
+  * @param  hscan pipeline handle
+  * @param  ElapsedMs time since ADCSCAN_ResetStats(), in ms
+  * @param  Report throughput report
+  * @retval SUCCESS, or ERROR when no time has elapsed
+  */
+ErrorStatus ADCSCAN_GetReport(const ADCSCAN_HandleTypeDef *hscan, uint32_t ElapsedMs, ADCSCAN_ReportTypeDef *Report)
+{
+  uint64_t span;
+
+  if ((ElapsedMs == 0UL) || (SystemCoreClock == 0UL))
+  {
+    return ERROR;
+  }
+
+  /* Elapsed time in core cycles */
+  span = ((uint64_t)ElapsedMs * SystemCoreClock) / 1000U;
+
+  Report->SampleRate = ADCSCAN_GetSampleRate(hscan);
+  Report->FrameRate = (uint32_t)(((uint64_t)hscan->Stats.Frames * 1000U) / ElapsedMs);
+  Report->SustainedRate = (uint32_t)(((uint64_t)hscan->Stats.Frames * hscan->NbChannels * 1000U) / ElapsedMs);
+  Report->LoadPpm = (uint32_t)((hscan->Stats.TotalCycles * 1000000U) / span);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Clear the statistics.
+  * @param  hscan pipeline handle
+  * @retval None
+  */
+void ADCSCAN_ResetStats(ADCSCAN_HandleTypeDef *hscan)
+{
+  hscan->Stats.Halves = 0UL;
+  hscan->Stats.Frames = 0UL;
+  hscan->Stats.Late = 0UL;
+  hscan->Stats.Overruns = 0UL;
+  hscan->Stats.DmaErrors = 0UL;
+  hscan->Stats.LastCycles = 0UL;
+  hscan->Stats.MaxCycles = 0UL;
+  hscan->Stats.TotalCycles = 0U;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
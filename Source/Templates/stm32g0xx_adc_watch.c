@@ -0,0 +1,428 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_adc_watch.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx ADC analog watchdog event capture.
+  *
+  *   This file provides:
+  *      - ADCWATCH_Init() / Start() / Stop(): scan pipeline and watchdog
+  *                                            windows setup.
+  *
+  *      - ADCWATCH_ADC_IRQHandler(): watchdog events, locates the trigger
+  *                                   frame in the ring; overrun recovery.
+  *
+  *      - ADCWATCH_Rearm(): unmasks the watchdog interrupts after a
+  *                          capture.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_adc_watch
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_adc_watch.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Private_Defines
+  * @{
+  */
+
+#define ADCWATCH_ALL                   (ADCWATCH_AWD1 | ADCWATCH_AWD2 | ADCWATCH_AWD3)
+
+#define ADCWATCH_CODE_MAX              (0xFFFUL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Private_Variables
+  * @{
+  */
+
+/* ADC_ISR flag, and ADC_IER enable, per watchdog */
+static const uint32_t ADCWATCH_Flag[ADCWATCH_NB_WATCHDOGS] =
+{
+  ADCWATCH_AWD1,
+  ADCWATCH_AWD2,
+  ADCWATCH_AWD3
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Find the channels of the trigger frame outside their window.
+  * @param  hwatch event capture handle
+  * @param  Frame trigger frame
+  * @retval ADC_CHSELR bit mask
+  */
+static uint32_t ADCWATCH_Outside(const ADCWATCH_HandleTypeDef *hwatch, const uint16_t *Frame)
+{
+  const ADCWATCH_WindowTypeDef *window;
+  uint32_t outside = 0UL;
+  uint32_t mask;
+  uint32_t channel;
+  uint32_t w;
+
+  /* Frames are in ascending channel order */
+  for (mask = hwatch->Scan.Channels; mask != 0UL; mask &= mask - 1UL)
+  {
+    channel = mask & (0UL - mask);
+    for (w = 0UL; w < ADCWATCH_NB_WATCHDOGS; w++)
+    {
+      window = &hwatch->Window[w];
+      if (((hwatch->Fired & ADCWATCH_Flag[w]) != 0UL) && ((window->Channels & channel) != 0UL) &&
+          ((*Frame < window->Low) || (*Frame > window->High)))
+      {
+        outside |= channel;
+      }
+    }
+    Frame++;
+  }
+
+  return outside;
+}
+
+/**
+  * @brief  Copy the window around the trigger out of the ring and hand it
+  *         to the callback.
+  * @note   Called at the first half boundary past the last post-trigger
+  *         frame; the DMA is then writing after the window.
+  * @param  hwatch event capture handle
+  * @retval None
+  */
+static void ADCWATCH_Complete(ADCWATCH_HandleTypeDef *hwatch)
+{
+  ADCSCAN_HandleTypeDef *hscan = &hwatch->Scan;
+  ADCWATCH_EventTypeDef event;
+  uint32_t size = 2UL * hscan->HalfSamples;
+  uint32_t frames = hwatch->PreFrames + 1UL + hwatch->PostFrames;
+  uint32_t count = frames * hscan->NbChannels;
+  uint32_t first;
+  uint32_t index;
+  uint32_t written;
+  uint32_t i;
+
+  first = ((hwatch->TriggerFrame * hscan->NbChannels) + size - (hwatch->PreFrames * hscan->NbChannels)) % size;
+  index = first;
+  for (i = 0UL; i < count; i++)
+  {
+    hwatch->Capture[i] = hscan->Buffer[index];
+    index++;
+    if (index == size)
+    {
+      index = 0UL;
+    }
+  }
+
+  /* Results written since the boundary must not have reached the window */
+  written = ((size - (hscan->Channel->CNDTR & DMA_CNDTR_NDT)) + size - hwatch->LastPosition) % size;
+  event.Overwritten = 0UL;
+  if (written > ((first + size - hwatch->LastPosition) % size))
+  {
+    event.Overwritten = 1UL;
+    hwatch->Stats.Overwritten++;
+  }
+
+  event.Watchdogs = hwatch->Fired;
+  event.Channels = ADCWATCH_Outside(hwatch, &hwatch->Capture[hwatch->PreFrames * hscan->NbChannels]);
+  event.Frames = hwatch->Capture;
+  event.NbFrames = frames;
+  event.Trigger = hwatch->PreFrames;
+
+  hwatch->Pending = 0UL;
+  hwatch->Stats.Captures++;
+  hwatch->Callback(hwatch, &event);
+
+  if (hwatch->AutoRearm != 0UL)
+  {
+    ADCWATCH_Rearm(hwatch);
+  }
+}
+
+/**
+  * @brief  Scan pipeline callback, one per half of the ring.
+  * @note   Returns at once unless a capture waits for its post-trigger
+  *         frames.
+  * @param  hscan scan pipeline handle, first member of the event handle
+  * @param  Frames released half
+  * @param  NbFrames frames in the half
+  * @retval None
+  */
+static void ADCWATCH_Half(ADCSCAN_HandleTypeDef *hscan, const uint16_t *Frames, uint32_t NbFrames)
+{
+  ADCWATCH_HandleTypeDef *hwatch = (ADCWATCH_HandleTypeDef *)hscan;
+  uint32_t size = 2UL * hscan->HalfSamples;
+  uint32_t boundary;
+  uint32_t done;
+
+  (void)NbFrames;
+
+  if (hwatch->Pending == 0UL)
+  {
+    return;
+  }
+
+  /* The DMA has just crossed the end of the released half */
+  boundary = (Frames == hscan->Buffer) ? hscan->HalfSamples : 0UL;
+  done = (boundary + size - hwatch->LastPosition) % size;
+  if (done > hscan->HalfSamples)
+  {
+    /* Boundary crossed before the trigger, its interrupt was still pending */
+    done = 0UL;
+  }
+  hwatch->LastPosition = boundary;
+
+  if (done < hwatch->Remaining)
+  {
+    hwatch->Remaining -= done;
+  }
+  else
+  {
+    ADCWATCH_Complete(hwatch);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_ADC_Watch_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the scan pipeline and the watchdogs, left stopped.
+  * @note   Scan.Callback is set here. AWD1 watches one channel, or all of
+  *         them when its window lists the whole scanned set.
+  * @param  hwatch event capture handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus ADCWATCH_Init(ADCWATCH_HandleTypeDef *hwatch)
+{
+  const ADCWATCH_WindowTypeDef *window;
+  ADC_TypeDef *adc;
+  uint32_t channels;
+  uint32_t awd1 = 0UL;
+  uint32_t w;
+
+  if ((hwatch == NULL) || (hwatch->Capture == NULL) || (hwatch->Callback == NULL) ||
+      (hwatch->PreFrames >= hwatch->Scan.FramesPerHalf) || (hwatch->PostFrames >= hwatch->Scan.FramesPerHalf) ||
+      ((hwatch->PreFrames + 1UL + hwatch->PostFrames) > hwatch->Scan.FramesPerHalf))
+  {
+    return ERROR;
+  }
+
+  hwatch->Armed = 0UL;
+  for (w = 0UL; w < ADCWATCH_NB_WATCHDOGS; w++)
+  {
+    window = &hwatch->Window[w];
+    channels = window->Channels;
+    if (channels == 0UL)
+    {
+      continue;
+    }
+    if (((channels & ~hwatch->Scan.Channels) != 0UL) || (window->Low > window->High) ||
+        (window->High > ADCWATCH_CODE_MAX))
+    {
+      return ERROR;
+    }
+    if (w == 0UL)
+    {
+      if (channels == hwatch->Scan.Channels)
+      {
+        awd1 = ADC_CFGR1_AWD1EN;
+      }
+      else if ((channels & (channels - 1UL)) == 0UL)
+      {
+        awd1 = ADC_CFGR1_AWD1EN | ADC_CFGR1_AWD1SGL;
+        while ((channels & 1UL) == 0UL)
+        {
+          channels >>= 1U;
+          awd1 += 1UL << ADC_CFGR1_AWD1CH_Pos;
+        }
+      }
+      else
+      {
+        return ERROR;
+      }
+    }
+    hwatch->Armed |= ADCWATCH_Flag[w];
+  }
+  if (hwatch->Armed == 0UL)
+  {
+    return ERROR;
+  }
+
+  hwatch->Scan.Callback = ADCWATCH_Half;
+  if (ADCSCAN_Init(&hwatch->Scan) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* Windows: the conversions are not started, CFGR1 is writable */
+  adc = hwatch->Scan.Instance;
+  SET_BIT(adc->CFGR1, awd1);
+  adc->TR1 = ((uint32_t)hwatch->Window[0].High << ADC_TR1_HT1_Pos) | hwatch->Window[0].Low;
+  adc->TR2 = ((uint32_t)hwatch->Window[1].High << ADC_TR2_HT2_Pos) | hwatch->Window[1].Low;
+  adc->TR3 = ((uint32_t)hwatch->Window[2].High << ADC_TR3_HT3_Pos) | hwatch->Window[2].Low;
+  adc->AWD2CR = hwatch->Window[1].Channels;
+  adc->AWD3CR = hwatch->Window[2].Channels;
+
+  hwatch->Pending = 0UL;
+  hwatch->Fired = 0UL;
+  ADCWATCH_ResetStats(hwatch);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Arm the watchdogs and start the scan.
+  * @param  hwatch event capture handle
+  * @retval None
+  */
+void ADCWATCH_Start(ADCWATCH_HandleTypeDef *hwatch)
+{
+  hwatch->Pending = 0UL;
+  ADCWATCH_Rearm(hwatch);
+  ADCSCAN_Start(&hwatch->Scan);
+}
+
+/**
+  * @brief  Stop the scan; a capture in progress is dropped.
+  * @param  hwatch event capture handle
+  * @retval None
+  */
+void ADCWATCH_Stop(ADCWATCH_HandleTypeDef *hwatch)
+{
+  CLEAR_BIT(hwatch->Scan.Instance->IER, hwatch->Armed);
+  ADCSCAN_Stop(&hwatch->Scan);
+  hwatch->Pending = 0UL;
+}
+
+/**
+  * @brief  Unmask the watchdog interrupts.
+  * @note   Without AutoRearm, call it from the event callback or later; a
+  *         channel still outside its window fires again at once.
+  * @param  hwatch event capture handle
+  * @retval None
+  */
+void ADCWATCH_Rearm(ADCWATCH_HandleTypeDef *hwatch)
+{
+  ADC_TypeDef *adc = hwatch->Scan.Instance;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (hwatch->Pending == 0UL)
+  {
+    adc->ISR = hwatch->Armed;
+    SET_BIT(adc->IER, hwatch->Armed);
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Handle the ADC interrupt.
+  * @note   The DMA interrupt goes to ADCSCAN_DMA_IRQHandler(&hwatch->Scan).
+  * @param  hwatch event capture handle
+  * @retval None
+  */
+void ADCWATCH_ADC_IRQHandler(ADCWATCH_HandleTypeDef *hwatch)
+{
+  ADCSCAN_HandleTypeDef *hscan = &hwatch->Scan;
+  ADC_TypeDef *adc = hscan->Instance;
+  uint32_t size = 2UL * hscan->HalfSamples;
+  uint32_t fired;
+  uint32_t position;
+  uint32_t last;
+
+  /* Overrun: the scan restarts at the top of the ring */
+  if ((adc->ISR & ADC_ISR_OVR) != 0UL)
+  {
+    if (hwatch->Pending != 0UL)
+    {
+      hwatch->Pending = 0UL;
+      hwatch->Stats.Aborted++;
+    }
+    ADCSCAN_ADC_IRQHandler(hscan);
+    ADCWATCH_Rearm(hwatch);
+    return;
+  }
+
+  /* IE bits line up with the flags */
+  fired = adc->ISR & adc->IER & ADCWATCH_ALL;
+  if (fired == 0UL)
+  {
+    return;
+  }
+
+  /* Mask the watchdogs until the capture is done, the window may stay left */
+  CLEAR_BIT(adc->IER, hwatch->Armed);
+  adc->ISR = hwatch->Armed;
+
+  /* The trigger result is the last one moved by the DMA */
+  position = (size - (hscan->Channel->CNDTR & DMA_CNDTR_NDT)) % size;
+  last = (position + size - 1UL) % size;
+  hwatch->TriggerFrame = last / hscan->NbChannels;
+  hwatch->LastPosition = position;
+  hwatch->Remaining = ((hwatch->TriggerFrame + 1UL + hwatch->PostFrames) * hscan->NbChannels) - (last + 1UL);
+  hwatch->Fired = fired;
+  hwatch->Stats.Events++;
+  hwatch->Pending = 1UL;
+}
+
+/**
+  * @brief  Clear the statistics.
+  * @param  hwatch event capture handle
+  * @retval None
+  */
+void ADCWATCH_ResetStats(ADCWATCH_HandleTypeDef *hwatch)
+{
+  hwatch->Stats.Events = 0UL;
+  hwatch->Stats.Captures = 0UL;
+  hwatch->Stats.Aborted = 0UL;
+  hwatch->Stats.Overwritten = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
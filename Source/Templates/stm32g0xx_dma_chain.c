@@ -0,0 +1,360 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_chain.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMA descriptor chain engine.
+  *
+  *   This file provides a software scatter-gather engine on top of one
+  *   DMA_Channel_TypeDef:
+  *      - DMACHAIN_Init(): validates the handle and routes the DMAMUX1 channel.
+  *
+  *      - DMACHAIN_Start(): loads the first descriptor and enables the channel.
+  *
+  *      - DMACHAIN_IRQHandler(): must be called from the DMA channel interrupt
+  *                               vector. It reloads the next descriptor on
+  *                               transfer complete, before running any user
+  *                               callback, to keep the inter-segment gap short.
+  *
+  *   The channel has to be disabled to reload CNDTR, so the handler writes the
+  *   precomputed CCR value (EN cleared), the new addresses and length, then
+  *   the CCR value again with EN set: five stores per segment switch.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_chain
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_DMA_Chain_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_dma_chain.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Chain_Private_Defines
+  * @{
+  */
+
+/* Configuration bits owned by the user in DMACHAIN_HandleTypeDef::Config */
+#define DMACHAIN_CONFIG_MASK   (DMA_CCR_DIR | DMA_CCR_PINC | DMA_CCR_MINC | DMA_CCR_PSIZE | \
+                                DMA_CCR_MSIZE | DMA_CCR_PL | DMA_CCR_MEM2MEM)
+
+/* DMAMUX request IDs 1 to 4 select request generators 0 to 3 */
+#define DMACHAIN_REQGEN_FIRST_ID   (1UL)
+#define DMACHAIN_REQGEN_LAST_ID    (4UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Chain_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Return the request generator pacing the channel.
+  * @param  hchain chain handle
+  * @retval Request generator
+  */
+static DMAMUX_RequestGen_TypeDef *DMACHAIN_GetReqGen(const DMACHAIN_HandleTypeDef *hchain)
+{
+  return DMAMUX1_RequestGenerator0 + (hchain->Request - DMACHAIN_REQGEN_FIRST_ID);
+}
+
+/**
+  * @brief  Check every descriptor of a chain, endless rings included.
+  * @note   A zero Length would never raise TC and stall the chain. The two
+  *         pointer walk ends once the fast pointer reaches the end of the
+  *         chain or catches up with the slow one, after every descriptor
+  *         of a ring was seen.
+  * @param  Head first descriptor of the chain
+  * @retval 1 when valid, 0 otherwise
+  */
+static uint32_t DMACHAIN_IsChainValid(const DMACHAIN_DescTypeDef *Head)
+{
+  const DMACHAIN_DescTypeDef *slow = Head;
+  const DMACHAIN_DescTypeDef *fast = Head;
+
+  while (fast != NULL)
+  {
+    if (fast->Length == 0U)
+    {
+      return 0UL;
+    }
+    fast = fast->Next;
+    if (fast == NULL)
+    {
+      break;
+    }
+    if (fast->Length == 0U)
+    {
+      return 0UL;
+    }
+    fast = fast->Next;
+    slow = slow->Next;
+    if (fast == slow)
+    {
+      break;
+    }
+  }
+
+  return 1UL;
+}
+
+/**
+  * @brief  Load a descriptor into the disabled channel and enable it.
+  * @param  hchain chain handle
+  * @param  Desc descriptor to load
+  * @retval None
+  */
+__STATIC_INLINE void DMACHAIN_Load(DMACHAIN_HandleTypeDef *hchain, const DMACHAIN_DescTypeDef *Desc)
+{
+  DMA_Channel_TypeDef *channel = hchain->Channel;
+
+  channel->CCR = hchain->CCRValue;
+  channel->CNDTR = Desc->Length;
+  channel->CMAR = Desc->MemAddress;
+  if (Desc->PeriphAddress != 0UL)
+  {
+    channel->CPAR = Desc->PeriphAddress;
+  }
+  channel->CCR = hchain->CCRValue | DMA_CCR_EN;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Chain_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the chain engine.
+  * @note   Config, Request, Trigger, ReqGenConfig and callbacks must be set
+  *         in the handle before this call.
+  * @param  hchain chain handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus DMACHAIN_Init(DMACHAIN_HandleTypeDef *hchain)
+{
+  if ((hchain == NULL) || (hchain->Channel == NULL))
+  {
+    return ERROR;
+  }
+  if ((hchain->Trigger == DMACHAIN_TRIGGER_REQGEN) &&
+      ((hchain->Request < DMACHAIN_REQGEN_FIRST_ID) || (hchain->Request > DMACHAIN_REQGEN_LAST_ID)))
+  {
+    return ERROR;
+  }
+
+  DMA_UTIL_EnableClock(hchain->Channel);
+
+  hchain->Channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hchain->Channel, DMA_UTIL_FLAG_ALL);
+
+  hchain->CCRValue = (hchain->Config & DMACHAIN_CONFIG_MASK) | DMA_CCR_TCIE | DMA_CCR_TEIE;
+  hchain->Active = NULL;
+  hchain->State = DMACHAIN_STATE_IDLE;
+  DMACHAIN_ResetStats(hchain);
+
+  DMA_UTIL_GetMuxChannel(hchain->Channel)->CCR = (hchain->Request << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+
+  if (hchain->Trigger == DMACHAIN_TRIGGER_REQGEN)
+  {
+    DMACHAIN_GetReqGen(hchain)->RGCR = hchain->ReqGenConfig & ~(DMAMUX_RGxCR_GE | DMAMUX_RGxCR_OIE);
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start transferring a chain.
+  * @param  hchain chain handle
+  * @param  Head first descriptor of the chain
+  * @retval SUCCESS, or ERROR when a chain is already in progress or a
+  *         descriptor has a zero Length
+  */
+ErrorStatus DMACHAIN_Start(DMACHAIN_HandleTypeDef *hchain, const DMACHAIN_DescTypeDef *Head)
+{
+  if ((Head == NULL) || (hchain->State == DMACHAIN_STATE_BUSY) || (DMACHAIN_IsChainValid(Head) == 0UL))
+  {
+    return ERROR;
+  }
+
+  hchain->Active = Head;
+  hchain->State = DMACHAIN_STATE_BUSY;
+  DMA_UTIL_ClearFlags(hchain->Channel, DMA_UTIL_FLAG_ALL);
+  DMACHAIN_Load(hchain, Head);
+
+  if (hchain->Trigger == DMACHAIN_TRIGGER_REQGEN)
+  {
+    SET_BIT(DMACHAIN_GetReqGen(hchain)->RGCR, DMAMUX_RGxCR_GE);
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Abort the chain in progress.
+  * @param  hchain chain handle
+  * @retval None
+  */
+void DMACHAIN_Stop(DMACHAIN_HandleTypeDef *hchain)
+{
+  if (hchain->Trigger == DMACHAIN_TRIGGER_REQGEN)
+  {
+    CLEAR_BIT(DMACHAIN_GetReqGen(hchain)->RGCR, DMAMUX_RGxCR_GE);
+  }
+  hchain->Channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hchain->Channel, DMA_UTIL_FLAG_ALL);
+  hchain->Active = NULL;
+  hchain->State = DMACHAIN_STATE_IDLE;
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @note   Must be called from the DMA channel interrupt vector. When several
+  *         channels share a vector, call it for each chain handle, or register
+  *         DMACHAIN_FlagsHandler() with the DMA interrupt demultiplexer.
+  * @param  hchain chain handle
+  * @retval None
+  */
+void DMACHAIN_IRQHandler(DMACHAIN_HandleTypeDef *hchain)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hchain->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hchain->Channel, flags);
+    DMACHAIN_FlagsHandler(hchain, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context chain handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void DMACHAIN_FlagsHandler(void *Context, uint32_t Flags)
+{
+  uint32_t start = DMA_UTIL_CycleStamp();
+  DMACHAIN_HandleTypeDef *hchain = (DMACHAIN_HandleTypeDef *)Context;
+  const DMACHAIN_DescTypeDef *done = hchain->Active;
+  const DMACHAIN_DescTypeDef *next;
+  uint32_t cycles;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    /* The hardware already cleared EN on a transfer error */
+    if (hchain->Trigger == DMACHAIN_TRIGGER_REQGEN)
+    {
+      CLEAR_BIT(DMACHAIN_GetReqGen(hchain)->RGCR, DMAMUX_RGxCR_GE);
+    }
+    hchain->Channel->CCR = 0UL;
+    hchain->Active = NULL;
+    hchain->State = DMACHAIN_STATE_ERROR;
+    hchain->Stats.Errors++;
+    if (hchain->ErrorCallback != NULL)
+    {
+      hchain->ErrorCallback(hchain);
+    }
+    return;
+  }
+
+  if (((Flags & DMA_UTIL_FLAG_TC) == 0UL) || (done == NULL))
+  {
+    return;
+  }
+
+  /* Re-arm first, account and notify afterwards */
+  next = done->Next;
+  if (next != NULL)
+  {
+    DMACHAIN_Load(hchain, next);
+    cycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+    hchain->Stats.LastReloadCycles = cycles;
+    if (cycles > hchain->Stats.MaxReloadCycles)
+    {
+      hchain->Stats.MaxReloadCycles = cycles;
+    }
+  }
+  else
+  {
+    if (hchain->Trigger == DMACHAIN_TRIGGER_REQGEN)
+    {
+      CLEAR_BIT(DMACHAIN_GetReqGen(hchain)->RGCR, DMAMUX_RGxCR_GE);
+    }
+    hchain->Channel->CCR = hchain->CCRValue;
+    hchain->State = DMACHAIN_STATE_IDLE;
+  }
+  hchain->Active = next;
+
+  hchain->Stats.Segments++;
+  hchain->Stats.Units += done->Length;
+
+  if (((done->Flags & DMACHAIN_DESC_NOTIFY) != 0U) && (hchain->SegmentCallback != NULL))
+  {
+    hchain->SegmentCallback(hchain, done);
+  }
+  if (next == NULL)
+  {
+    hchain->Stats.Chains++;
+    if (hchain->CompleteCallback != NULL)
+    {
+      hchain->CompleteCallback(hchain);
+    }
+  }
+}
+
+/**
+  * @brief  Reset the engine statistics.
+  * @param  hchain chain handle
+  * @retval None
+  */
+void DMACHAIN_ResetStats(DMACHAIN_HandleTypeDef *hchain)
+{
+  hchain->Stats.Segments = 0UL;
+  hchain->Stats.Chains = 0UL;
+  hchain->Stats.Units = 0UL;
+  hchain->Stats.Errors = 0UL;
+  hchain->Stats.LastReloadCycles = 0UL;
+  hchain->Stats.MaxReloadCycles = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
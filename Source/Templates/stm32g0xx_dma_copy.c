@@ -0,0 +1,484 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_copy.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMA accelerated memcpy/memset.
+  *
+  *   This file provides:
+  *      - DMACOPY_Init(): reserves a DMA channel for memory to memory requests.
+  *
+  *      - DMACOPY_Memcpy() / DMACOPY_Memset(): run the request on the CPU when
+  *                         it is below the cutover size, otherwise start it on
+  *                         the DMA and return immediately. The callback runs
+  *                         on completion, from the DMA interrupt for DMA
+  *                         requests and before returning for CPU requests.
+  *
+  *      - DMACOPY_IRQHandler(): must be called from the DMA channel interrupt
+  *                              vector.
+  *
+  *      - DMACOPY_Benchmark(): CPU and DMA copy cycles of one size at each
+  *                             transfer width, to tune the cutover.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_copy
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_DMA_Copy_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_dma_copy.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Copy_Private_Defines
+  * @{
+  */
+
+#define DMACOPY_MAX_UNITS    (0xFFFFUL)  /*!< CNDTR limit */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Copy_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Select the widest transfer size allowed by the request alignment.
+  * @param  Alignment OR of both addresses and of the size
+  * @retval log2 of the data unit size in bytes
+  */
+static uint32_t DMACOPY_GetShift(uint32_t Alignment)
+{
+  if ((Alignment & 3UL) == 0UL)
+  {
+    return 2UL;
+  }
+  if ((Alignment & 1UL) == 0UL)
+  {
+    return 1UL;
+  }
+  return 0UL;
+}
+
+/**
+  * @brief  Return the cutover size for a transfer size.
+  * @param  hcopy copy handle
+  * @param  Shift log2 of the data unit size
+  * @retval Cutover size in bytes
+  */
+static uint32_t DMACOPY_GetCutover(const DMACOPY_HandleTypeDef *hcopy, uint32_t Shift)
+{
+  if (Shift == 2UL)
+  {
+    return hcopy->Cutover;
+  }
+  if (Shift == 1UL)
+  {
+    return hcopy->Cutover * DMACOPY_CUTOVER_HALFWORD_MUL;
+  }
+  return hcopy->Cutover * DMACOPY_CUTOVER_BYTE_MUL;
+}
+
+/**
+  * @brief  Program and enable the next chunk of the running request.
+  * @param  hcopy copy handle
+  * @retval None
+  */
+static void DMACOPY_StartChunk(DMACOPY_HandleTypeDef *hcopy)
+{
+  DMA_Channel_TypeDef *channel = hcopy->Channel;
+  uint32_t units = (hcopy->Remaining > DMACOPY_MAX_UNITS) ? DMACOPY_MAX_UNITS : hcopy->Remaining;
+
+  channel->CCR = hcopy->CCRValue;
+  channel->CNDTR = units;
+  channel->CPAR = hcopy->Source;
+  channel->CMAR = hcopy->Destination;
+  channel->CCR = hcopy->CCRValue | DMA_CCR_EN;
+}
+
+/**
+  * @brief  Start a DMA request.
+  * @param  hcopy copy handle
+  * @param  Dst destination address
+  * @param  Src source address
+  * @param  Size size in bytes
+  * @param  Shift log2 of the data unit size
+  * @param  SrcInc DMA_CCR_PINC to increment the source, 0 for a fill
+  * @retval None
+  */
+static void DMACOPY_StartDma(DMACOPY_HandleTypeDef *hcopy, uint32_t Dst, uint32_t Src, uint32_t Size,
+                             uint32_t Shift, uint32_t SrcInc)
+{
+  hcopy->Source = Src;
+  hcopy->Destination = Dst;
+  hcopy->Remaining = Size >> Shift;
+  hcopy->CCRValue = DMA_CCR_MEM2MEM | DMA_CCR_MINC | SrcInc | (hcopy->Priority & DMA_CCR_PL)
+                    | (Shift << DMA_CCR_PSIZE_Pos) | (Shift << DMA_CCR_MSIZE_Pos)
+                    | DMA_CCR_TCIE | DMA_CCR_TEIE;
+  hcopy->Status = SUCCESS;
+  hcopy->Stats.DmaRequests++;
+  hcopy->Stats.DmaBytes += Size;
+  DMA_UTIL_ClearFlags(hcopy->Channel, DMA_UTIL_FLAG_ALL);
+  DMACOPY_StartChunk(hcopy);
+}
+
+/**
+  * @brief  Time one copy by the DMA, polled.
+  * @param  hcopy copy handle
+  * @param  Dst destination address
+  * @param  Src source address
+  * @param  Size size in bytes, at most DMACOPY_MAX_UNITS data units
+  * @param  Shift log2 of the data unit size
+  * @param  Cycles setup to transfer complete
+  * @retval SUCCESS or ERROR on a transfer error
+  */
+static ErrorStatus DMACOPY_TimeDma(DMACOPY_HandleTypeDef *hcopy, uint32_t Dst, uint32_t Src, uint32_t Size,
+                                   uint32_t Shift, uint32_t *Cycles)
+{
+  DMA_Channel_TypeDef *channel = hcopy->Channel;
+  uint32_t ccr = DMA_CCR_MEM2MEM | DMA_CCR_MINC | DMA_CCR_PINC | (hcopy->Priority & DMA_CCR_PL)
+                 | (Shift << DMA_CCR_PSIZE_Pos) | (Shift << DMA_CCR_MSIZE_Pos);
+  uint32_t start;
+  uint32_t flags;
+
+  start = DMA_UTIL_CycleStamp();
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+  channel->CCR = ccr;
+  channel->CNDTR = Size >> Shift;
+  channel->CPAR = Src;
+  channel->CMAR = Dst;
+  channel->CCR = ccr | DMA_CCR_EN;
+  do
+  {
+    flags = DMA_UTIL_GetFlags(channel);
+  } while ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) == 0UL);
+  *Cycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+
+  channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+
+  return ((flags & DMA_UTIL_FLAG_TE) != 0UL) ? ERROR : SUCCESS;
+}
+
+/**
+  * @brief  Claim the engine for a new request.
+  * @param  hcopy copy handle
+  * @retval SUCCESS or ERROR when a DMA request is still running
+  */
+static ErrorStatus DMACOPY_Claim(DMACOPY_HandleTypeDef *hcopy)
+{
+  uint32_t primask = __get_PRIMASK();
+  ErrorStatus status = ERROR;
+
+  __disable_irq();
+  if (hcopy->Busy == 0UL)
+  {
+    hcopy->Busy = 1UL;
+    status = SUCCESS;
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Copy_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the copy engine.
+  * @note   Cutover and Priority may be changed in the handle after this call.
+  * @param  hcopy copy handle
+  * @param  Channel free DMA channel
+  * @retval SUCCESS or ERROR on an invalid parameter
+  */
+ErrorStatus DMACOPY_Init(DMACOPY_HandleTypeDef *hcopy, DMA_Channel_TypeDef *Channel)
+{
+  if ((hcopy == NULL) || (Channel == NULL))
+  {
+    return ERROR;
+  }
+
+  hcopy->Channel = Channel;
+  hcopy->Cutover = DMACOPY_CUTOVER_DEFAULT;
+  hcopy->Priority = 0UL;
+  hcopy->Busy = 0UL;
+  hcopy->Status = SUCCESS;
+  hcopy->Callback = NULL;
+  hcopy->Context = NULL;
+  hcopy->Stats.CpuRequests = 0UL;
+  hcopy->Stats.DmaRequests = 0UL;
+  hcopy->Stats.DmaBytes = 0UL;
+  hcopy->Stats.Errors = 0UL;
+
+  DMA_UTIL_EnableClock(Channel);
+  Channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(Channel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(Channel)->CCR = 0UL;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Copy a memory block.
+  * @param  hcopy copy handle
+  * @param  Dst destination address
+  * @param  Src source address
+  * @param  Size size in bytes
+  * @param  Callback completion callback, may be NULL
+  * @param  Context callback argument
+  * @retval SUCCESS, or ERROR when a DMA request is still running
+  */
+ErrorStatus DMACOPY_Memcpy(DMACOPY_HandleTypeDef *hcopy, void *Dst, const void *Src, uint32_t Size,
+                           DMACOPY_CallbackTypeDef Callback, void *Context)
+{
+  uint32_t shift = DMACOPY_GetShift((uint32_t)Dst | (uint32_t)Src | Size);
+
+  if (DMACOPY_Claim(hcopy) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  if ((Size == 0UL) || (Size < DMACOPY_GetCutover(hcopy, shift)))
+  {
+    (void)memcpy(Dst, Src, Size);
+    hcopy->Stats.CpuRequests++;
+    hcopy->Busy = 0UL;
+    if (Callback != NULL)
+    {
+      Callback(Context);
+    }
+    return SUCCESS;
+  }
+
+  hcopy->Callback = Callback;
+  hcopy->Context = Context;
+  DMACOPY_StartDma(hcopy, (uint32_t)Dst, (uint32_t)Src, Size, shift, DMA_CCR_PINC);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Fill a memory block.
+  * @param  hcopy copy handle
+  * @param  Dst destination address
+  * @param  Value fill byte
+  * @param  Size size in bytes
+  * @param  Callback completion callback, may be NULL
+  * @param  Context callback argument
+  * @retval SUCCESS, or ERROR when a DMA request is still running
+  */
+ErrorStatus DMACOPY_Memset(DMACOPY_HandleTypeDef *hcopy, void *Dst, uint8_t Value, uint32_t Size,
+                           DMACOPY_CallbackTypeDef Callback, void *Context)
+{
+  uint32_t shift = DMACOPY_GetShift((uint32_t)Dst | Size);
+
+  if (DMACOPY_Claim(hcopy) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  if ((Size == 0UL) || (Size < DMACOPY_GetCutover(hcopy, shift)))
+  {
+    (void)memset(Dst, Value, Size);
+    hcopy->Stats.CpuRequests++;
+    hcopy->Busy = 0UL;
+    if (Callback != NULL)
+    {
+      Callback(Context);
+    }
+    return SUCCESS;
+  }
+
+  /* Replicated so that byte, half-word and word reads all return the value */
+  hcopy->Fill = (uint32_t)Value * 0x01010101UL;
+  hcopy->Callback = Callback;
+  hcopy->Context = Context;
+  DMACOPY_StartDma(hcopy, (uint32_t)Dst, (uint32_t)&hcopy->Fill, Size, shift, 0UL);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Wait for the running DMA request, if any.
+  * @param  hcopy copy handle
+  * @retval SUCCESS, or ERROR when the last request ended on a transfer error
+  */
+ErrorStatus DMACOPY_Wait(DMACOPY_HandleTypeDef *hcopy)
+{
+  while (hcopy->Busy != 0UL)
+  {
+  }
+  return hcopy->Status;
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  hcopy copy handle
+  * @retval None
+  */
+void DMACOPY_IRQHandler(DMACOPY_HandleTypeDef *hcopy)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hcopy->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hcopy->Channel, flags);
+    DMACOPY_FlagsHandler(hcopy, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context copy handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void DMACOPY_FlagsHandler(void *Context, uint32_t Flags)
+{
+  DMACOPY_HandleTypeDef *hcopy = (DMACOPY_HandleTypeDef *)Context;
+  uint32_t shift;
+  uint32_t units;
+  DMACOPY_CallbackTypeDef callback;
+  void *context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hcopy->Status = ERROR;
+    hcopy->Stats.Errors++;
+    hcopy->Remaining = 0UL;
+  }
+  else if ((Flags & DMA_UTIL_FLAG_TC) != 0UL)
+  {
+    shift = (hcopy->CCRValue & DMA_CCR_MSIZE) >> DMA_CCR_MSIZE_Pos;
+    units = (hcopy->Remaining > DMACOPY_MAX_UNITS) ? DMACOPY_MAX_UNITS : hcopy->Remaining;
+    hcopy->Remaining -= units;
+    if (hcopy->Remaining != 0UL)
+    {
+      if ((hcopy->CCRValue & DMA_CCR_PINC) != 0UL)
+      {
+        hcopy->Source += units << shift;
+      }
+      hcopy->Destination += units << shift;
+      DMACOPY_StartChunk(hcopy);
+      return;
+    }
+  }
+  else
+  {
+    return;
+  }
+
+  hcopy->Channel->CCR = 0UL;
+  callback = hcopy->Callback;
+  context = hcopy->Context;
+  hcopy->Callback = NULL;
+  hcopy->Busy = 0UL;
+  if (callback != NULL)
+  {
+    callback(context);
+  }
+}
+
+/**
+  * @brief  Time one copy size on the CPU and on the DMA at each width.
+  * @note   Runs with interrupts masked and leaves the statistics untouched.
+  *         The widths come from the alignment, as for DMACOPY_Memcpy():
+  *         word at offset 0, half-word at offset 2 and byte at offset 1 of
+  *         both buffers. Call it once per size and clock configuration.
+  * @param  hcopy copy handle, idle
+  * @param  Dst word aligned destination of Size + 2 bytes
+  * @param  Src word aligned source of Size + 2 bytes
+  * @param  Size bytes per copy, a multiple of 4 up to 65532
+  * @param  Result cycles per width
+  * @retval SUCCESS, or ERROR while a request is running, on an invalid
+  *         parameter or on a transfer error
+  */
+ErrorStatus DMACOPY_Benchmark(DMACOPY_HandleTypeDef *hcopy, void *Dst, const void *Src, uint32_t Size,
+                              DMACOPY_BenchmarkTypeDef *Result)
+{
+  ErrorStatus status = SUCCESS;
+  uint32_t primask;
+  uint32_t shift;
+  uint32_t offset;
+  uint32_t start;
+
+  if ((Result == NULL) || (Dst == NULL) || (Src == NULL) || (Size == 0UL) || ((Size & 3UL) != 0UL) ||
+      (Size > DMACOPY_MAX_UNITS) || ((((uint32_t)Dst | (uint32_t)Src) & 3UL) != 0UL))
+  {
+    return ERROR;
+  }
+  if (DMACOPY_Claim(hcopy) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  Result->Size = Size;
+  for (shift = 0UL; shift < DMACOPY_NB_WIDTHS; shift++)
+  {
+    /* Offsets 1, 2 and 0 select the byte, half-word and word widths */
+    offset = (1UL << shift) & 3UL;
+
+    start = DMA_UTIL_CycleStamp();
+    (void)memcpy((uint8_t *)Dst + offset, (const uint8_t *)Src + offset, Size);
+    Result->CpuCycles[shift] = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+
+    if (DMACOPY_TimeDma(hcopy, (uint32_t)Dst + offset, (uint32_t)Src + offset, Size, shift,
+                        &Result->DmaCycles[shift]) != SUCCESS)
+    {
+      status = ERROR;
+    }
+  }
+
+  __set_PRIMASK(primask);
+  hcopy->Busy = 0UL;
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,342 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_irq.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMA interrupt demultiplexer.
+  *
+  *   This file provides the DMA interrupt entry points to be called from the
+  *   vectors of the startup file:
+  *      - DMAIRQ_Channel1_IRQHandler():   DMA1_Channel1_IRQHandler
+  *      - DMAIRQ_Channel2_3_IRQHandler(): DMA1_Channel2_3_IRQHandler
+  *      - DMAIRQ_Shared_IRQHandler():     DMA1_Ch4_5_DMAMUX1_OVR_IRQHandler,
+  *                                        DMA1_Ch4_7_DMAMUX1_OVR_IRQHandler or
+  *                                        DMA1_Ch4_7_DMA2_Ch1_5_DMAMUX1_OVR_IRQHandler
+  *
+  *   A handler table indexed by the package wide channel index (see
+  *   DMA_UTIL_GetGlobalIndex()) is filled by DMAIRQ_Register(). The flag
+  *   masks of the registered channels are kept per controller so that the
+  *   interrupt path only performs one ISR read and one IFCR write per
+  *   controller, then walks the pending flag groups four bits at a time.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_irq
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_dma_irq.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Private_Defines
+  * @{
+  */
+
+/* ISR flag groups served by each vector */
+#define DMAIRQ_CH1_MASK          (0x0000000FUL)   /*!< DMA1 channel 1               */
+#define DMAIRQ_CH2_3_MASK        (0x00000FF0UL)   /*!< DMA1 channels 2 and 3        */
+#if defined(DMA1_Channel7)
+#define DMAIRQ_SHARED_DMA1_MASK  (0x0FFFF000UL)   /*!< DMA1 channels 4 to 7         */
+#else
+#define DMAIRQ_SHARED_DMA1_MASK  (0x000FF000UL)   /*!< DMA1 channels 4 and 5        */
+#endif /* DMA1_Channel7 */
+#if defined(DMA2)
+#define DMAIRQ_SHARED_DMA2_MASK  (0x000FFFFFUL)   /*!< DMA2 channels 1 to 5         */
+#endif /* DMA2 */
+
+/* Index of the first channel served by each vector, in flag groups */
+#define DMAIRQ_CH1_FIRST         (0UL)
+#define DMAIRQ_CH2_3_FIRST       (1UL)
+#define DMAIRQ_SHARED_FIRST      (3UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Private_TypesDefinitions
+  * @{
+  */
+
+typedef struct
+{
+  DMAIRQ_HandlerTypeDef Handler;
+  void *Context;
+} DMAIRQ_EntryTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Private_Variables
+  * @{
+  */
+
+static DMAIRQ_EntryTypeDef DMAIRQ_Table[DMA_UTIL_NB_CHANNELS];
+static volatile uint32_t DMAIRQ_Dma1Mask = 0UL;
+#if defined(DMA2)
+static volatile uint32_t DMAIRQ_Dma2Mask = 0UL;
+#endif /* DMA2 */
+
+static DMAIRQ_OverrunHandlerTypeDef DMAIRQ_OverrunHandler = NULL;
+static void *DMAIRQ_OverrunContext = NULL;
+
+static DMAIRQ_StatsTypeDef DMAIRQ_Stats;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Acknowledge and dispatch the pending channels of one controller.
+  * @param  Dma DMA controller
+  * @param  Mask ISR flag groups of the registered channels served by the vector
+  * @param  First index of the first flag group to scan
+  * @param  Base package wide index of the controller channel 1
+  * @retval None
+  */
+static void DMAIRQ_Dispatch(DMA_TypeDef *Dma, uint32_t Mask, uint32_t First, uint32_t Base)
+{
+  uint32_t pending = Dma->ISR & Mask;
+  const DMAIRQ_EntryTypeDef *entry;
+
+  if (pending == 0UL)
+  {
+    return;
+  }
+  Dma->IFCR = pending;
+
+  pending >>= First * 4UL;
+  entry = &DMAIRQ_Table[Base + First];
+  while (pending != 0UL)
+  {
+    if ((pending & DMA_UTIL_FLAG_ALL) != 0UL)
+    {
+      entry->Handler(entry->Context, pending & DMA_UTIL_FLAG_ALL);
+      DMAIRQ_Stats.Dispatches++;
+    }
+    pending >>= 4UL;
+    entry++;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_IRQ_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Register the interrupt handler of a channel.
+  * @note   The channel interrupt enables (CCR TCIE/HTIE/TEIE) are left to the
+  *         caller. Flags of unregistered channels are never cleared by the
+  *         demultiplexer, so their interrupts must stay disabled.
+  * @param  Channel DMA channel
+  * @param  Handler channel handler
+  * @param  Context handler argument
+  * @retval SUCCESS or ERROR on an invalid parameter
+  */
+ErrorStatus DMAIRQ_Register(const DMA_Channel_TypeDef *Channel, DMAIRQ_HandlerTypeDef Handler, void *Context)
+{
+  uint32_t index;
+  uint32_t group;
+  uint32_t primask;
+
+  if ((Channel == NULL) || (Handler == NULL))
+  {
+    return ERROR;
+  }
+
+  index = DMA_UTIL_GetGlobalIndex(Channel);
+  group = DMA_UTIL_FLAG_ALL << (DMA_UTIL_GetChannelIndex(Channel) * 4UL);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  DMAIRQ_Table[index].Handler = Handler;
+  DMAIRQ_Table[index].Context = Context;
+#if defined(DMA2)
+  if (DMA_UTIL_GetController(Channel) == DMA2)
+  {
+    DMAIRQ_Dma2Mask |= group;
+  }
+  else
+#endif /* DMA2 */
+  {
+    DMAIRQ_Dma1Mask |= group;
+  }
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Remove the interrupt handler of a channel.
+  * @param  Channel DMA channel
+  * @retval None
+  */
+void DMAIRQ_Unregister(const DMA_Channel_TypeDef *Channel)
+{
+  uint32_t index = DMA_UTIL_GetGlobalIndex(Channel);
+  uint32_t group = DMA_UTIL_FLAG_ALL << (DMA_UTIL_GetChannelIndex(Channel) * 4UL);
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+#if defined(DMA2)
+  if (DMA_UTIL_GetController(Channel) == DMA2)
+  {
+    DMAIRQ_Dma2Mask &= ~group;
+  }
+  else
+#endif /* DMA2 */
+  {
+    DMAIRQ_Dma1Mask &= ~group;
+  }
+  DMAIRQ_Table[index].Handler = NULL;
+  DMAIRQ_Table[index].Context = NULL;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Register the DMAMUX1 overrun handler.
+  * @param  Handler overrun handler, NULL to only clear the overrun flags
+  * @param  Context handler argument
+  * @retval None
+  */
+void DMAIRQ_RegisterOverrun(DMAIRQ_OverrunHandlerTypeDef Handler, void *Context)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  DMAIRQ_OverrunHandler = Handler;
+  DMAIRQ_OverrunContext = Context;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  DMA1 channel 1 vector entry.
+  * @retval None
+  */
+void DMAIRQ_Channel1_IRQHandler(void)
+{
+  DMAIRQ_Dispatch(DMA1, DMAIRQ_Dma1Mask & DMAIRQ_CH1_MASK, DMAIRQ_CH1_FIRST, 0UL);
+}
+
+/**
+  * @brief  DMA1 channels 2 and 3 vector entry.
+  * @retval None
+  */
+void DMAIRQ_Channel2_3_IRQHandler(void)
+{
+  DMAIRQ_Dispatch(DMA1, DMAIRQ_Dma1Mask & DMAIRQ_CH2_3_MASK, DMAIRQ_CH2_3_FIRST, 0UL);
+}
+
+/**
+  * @brief  Shared DMA1 channel 4+, DMA2 and DMAMUX1 overrun vector entry.
+  * @retval None
+  */
+void DMAIRQ_Shared_IRQHandler(void)
+{
+  uint32_t start = DMA_UTIL_CycleStamp();
+  uint32_t sync;
+  uint32_t gen;
+  uint32_t cycles;
+
+  DMAIRQ_Dispatch(DMA1, DMAIRQ_Dma1Mask & DMAIRQ_SHARED_DMA1_MASK, DMAIRQ_SHARED_FIRST, 0UL);
+#if defined(DMA2)
+  DMAIRQ_Dispatch(DMA2, DMAIRQ_Dma2Mask & DMAIRQ_SHARED_DMA2_MASK, 0UL, DMA_UTIL_DMA1_NB_CHANNELS);
+#endif /* DMA2 */
+
+  sync = DMAMUX1_ChannelStatus->CSR;
+  gen = DMAMUX1_RequestGenStatus->RGSR;
+  if ((sync | gen) != 0UL)
+  {
+    DMAMUX1_ChannelStatus->CFR = sync;
+    DMAMUX1_RequestGenStatus->RGCFR = gen;
+    DMAIRQ_Stats.Overruns++;
+    if (DMAIRQ_OverrunHandler != NULL)
+    {
+      DMAIRQ_OverrunHandler(DMAIRQ_OverrunContext, sync, gen);
+    }
+  }
+
+  DMAIRQ_Stats.Invocations++;
+  cycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+  DMAIRQ_Stats.LastCycles = cycles;
+  if (cycles > DMAIRQ_Stats.MaxCycles)
+  {
+    DMAIRQ_Stats.MaxCycles = cycles;
+  }
+}
+
+/**
+  * @brief  Copy the demultiplexer statistics.
+  * @param  Stats destination
+  * @retval None
+  */
+void DMAIRQ_GetStats(DMAIRQ_StatsTypeDef *Stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *Stats = DMAIRQ_Stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Reset the demultiplexer statistics.
+  * @retval None
+  */
+void DMAIRQ_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  DMAIRQ_Stats.Invocations = 0UL;
+  DMAIRQ_Stats.Dispatches = 0UL;
+  DMAIRQ_Stats.Overruns = 0UL;
+  DMAIRQ_Stats.LastCycles = 0UL;
+  DMAIRQ_Stats.MaxCycles = 0UL;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
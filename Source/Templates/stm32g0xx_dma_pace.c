@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_dma_pace.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx DMAMUX1 request generator paced transfers.
+  *
+  *   This file provides:
+  *      - DMAPACE_Init(): routes the DMA channel to the request generator and
+  *                        programs the generator (trigger, edge, burst size).
+  *
+  *      - DMAPACE_Start() / DMAPACE_Stop(): arm the DMA channel then enable
+  *                        the generator, so no trigger is lost or half served.
+  *
+  *      - DMAPACE_IRQHandler(): DMA channel interrupt, half/full transfer and
+  *                              error callbacks.
+  *
+  *      - DMAPACE_CheckOverrun(): reads and clears the generator overrun flag
+  *                                in RGSR. To be called from the DMAMUX1
+  *                                overrun vector, or by polling when the
+  *                                overrun interrupt is not used.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_dma_pace
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_DMA_Pace_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_dma_pace.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Pace_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Return the request generator of a handle.
+  * @param  hpace paced transfer handle
+  * @retval Request generator
+  */
+__STATIC_INLINE DMAMUX_RequestGen_TypeDef *DMAPACE_GetGenerator(const DMAPACE_HandleTypeDef *hpace)
+{
+  return DMAMUX1_RequestGenerator0 + hpace->Generator;
+}
+
+/**
+  * @brief  Account a detected overrun.
+  * @param  hpace paced transfer handle
+  * @retval None
+  */
+static void DMAPACE_ReportOverrun(DMAPACE_HandleTypeDef *hpace)
+{
+  hpace->Stats.Overruns++;
+  if (hpace->OverrunCallback != NULL)
+  {
+    hpace->OverrunCallback(hpace);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_DMA_Pace_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize a paced transfer.
+  * @note   The trigger source itself (EXTI line, LPTIM, TIM14) is configured
+  *         by the application.
+  * @param  hpace paced transfer handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus DMAPACE_Init(DMAPACE_HandleTypeDef *hpace)
+{
+  uint32_t rgcr;
+
+  if ((hpace == NULL) || (hpace->Channel == NULL) ||
+      (hpace->Generator >= DMAPACE_NB_GENERATORS) ||
+      (hpace->RequestsPerTrigger == 0UL) || (hpace->RequestsPerTrigger > DMAPACE_MAX_REQUESTS) ||
+      (hpace->Length == 0UL) || (hpace->Length > DMA_CNDTR_NDT) ||
+      (hpace->DataSize > DMAPACE_SIZE_WORD))
+  {
+    return ERROR;
+  }
+
+  DMA_UTIL_EnableClock(hpace->Channel);
+
+  hpace->Channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hpace->Channel, DMA_UTIL_FLAG_ALL);
+  hpace->Running = 0UL;
+  hpace->Stats.Buffers = 0UL;
+  hpace->Stats.Overruns = 0UL;
+  hpace->Stats.Errors = 0UL;
+
+  /* Request IDs 1 to 4 select request generators 0 to 3 */
+  DMA_UTIL_GetMuxChannel(hpace->Channel)->CCR = (hpace->Generator + 1UL) << DMAMUX_CxCR_DMAREQ_ID_Pos;
+
+  rgcr = ((hpace->Signal << DMAMUX_RGxCR_SIG_ID_Pos) & DMAMUX_RGxCR_SIG_ID)
+       | (hpace->Polarity & DMAMUX_RGxCR_GPOL)
+       | (((hpace->RequestsPerTrigger - 1UL) << DMAMUX_RGxCR_GNBREQ_Pos) & DMAMUX_RGxCR_GNBREQ);
+  if (hpace->OverrunIT != 0UL)
+  {
+    rgcr |= DMAMUX_RGxCR_OIE;
+  }
+  DMAPACE_GetGenerator(hpace)->RGCR = rgcr;
+  DMAMUX1_RequestGenStatus->RGCFR = 1UL << hpace->Generator;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start streaming.
+  * @param  hpace paced transfer handle
+  * @retval SUCCESS or ERROR when already running
+  */
+ErrorStatus DMAPACE_Start(DMAPACE_HandleTypeDef *hpace)
+{
+  uint32_t ccr;
+
+  if (hpace->Running != 0UL)
+  {
+    return ERROR;
+  }
+
+  ccr = hpace->Direction | DMA_CCR_MINC | DMA_CCR_TCIE | DMA_CCR_TEIE
+      | (hpace->DataSize << DMA_CCR_PSIZE_Pos) | (hpace->DataSize << DMA_CCR_MSIZE_Pos);
+  if (hpace->Circular != 0UL)
+  {
+    ccr |= DMA_CCR_CIRC | DMA_CCR_HTIE;
+  }
+
+  DMA_UTIL_ClearFlags(hpace->Channel, DMA_UTIL_FLAG_ALL);
+  hpace->Channel->CNDTR = hpace->Length;
+  hpace->Channel->CPAR = hpace->PeriphAddress;
+  hpace->Channel->CMAR = hpace->MemAddress;
+  hpace->Channel->CCR = ccr | DMA_CCR_EN;
+
+  hpace->Running = 1UL;
+  DMAMUX1_RequestGenStatus->RGCFR = 1UL << hpace->Generator;
+  SET_BIT(DMAPACE_GetGenerator(hpace)->RGCR, DMAMUX_RGxCR_GE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stop streaming.
+  * @param  hpace paced transfer handle
+  * @retval None
+  */
+void DMAPACE_Stop(DMAPACE_HandleTypeDef *hpace)
+{
+  CLEAR_BIT(DMAPACE_GetGenerator(hpace)->RGCR, DMAMUX_RGxCR_GE);
+  hpace->Channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hpace->Channel, DMA_UTIL_FLAG_ALL);
+  hpace->Running = 0UL;
+}
+
+/**
+  * @brief  Return the index of the next data unit to be transferred.
+  * @param  hpace paced transfer handle
+  * @retval Position in the buffer, in data units
+  */
+uint32_t DMAPACE_GetPosition(const DMAPACE_HandleTypeDef *hpace)
+{
+  return hpace->Length - (hpace->Channel->CNDTR & DMA_CNDTR_NDT);
+}
+
+/**
+  * @brief  Check and clear the generator overrun flag.
+  * @param  hpace paced transfer handle
+  * @retval 1 when an overrun was pending, 0 otherwise
+  */
+uint32_t DMAPACE_CheckOverrun(DMAPACE_HandleTypeDef *hpace)
+{
+  uint32_t flag = 1UL << hpace->Generator;
+
+  if ((DMAMUX1_RequestGenStatus->RGSR & flag) == 0UL)
+  {
+    return 0UL;
+  }
+  DMAMUX1_RequestGenStatus->RGCFR = flag;
+  DMAPACE_ReportOverrun(hpace);
+
+  return 1UL;
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  hpace paced transfer handle
+  * @retval None
+  */
+void DMAPACE_IRQHandler(DMAPACE_HandleTypeDef *hpace)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hpace->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_HT | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hpace->Channel, flags);
+    DMAPACE_FlagsHandler(hpace, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context paced transfer handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void DMAPACE_FlagsHandler(void *Context, uint32_t Flags)
+{
+  DMAPACE_HandleTypeDef *hpace = (DMAPACE_HandleTypeDef *)Context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    CLEAR_BIT(DMAPACE_GetGenerator(hpace)->RGCR, DMAMUX_RGxCR_GE);
+    hpace->Channel->CCR = 0UL;
+    hpace->Running = 0UL;
+    hpace->Stats.Errors++;
+    if (hpace->ErrorCallback != NULL)
+    {
+      hpace->ErrorCallback(hpace);
+    }
+    return;
+  }
+
+  if (((Flags & DMA_UTIL_FLAG_HT) != 0UL) && (hpace->HalfCallback != NULL))
+  {
+    hpace->HalfCallback(hpace);
+  }
+
+  if ((Flags & DMA_UTIL_FLAG_TC) != 0UL)
+  {
+    hpace->Stats.Buffers++;
+    if (hpace->Circular == 0UL)
+    {
+      CLEAR_BIT(DMAPACE_GetGenerator(hpace)->RGCR, DMAMUX_RGxCR_GE);
+      hpace->Channel->CCR &= ~DMA_CCR_EN;
+      hpace->Running = 0UL;
+    }
+    if (hpace->CompleteCallback != NULL)
+    {
+      hpace->CompleteCallback(hpace);
+    }
+  }
+}
+
+/**
+  * @brief  Process a DMAMUX1 overrun snapshot already cleared by the caller.
+  * @note   Signature matches DMAIRQ_OverrunHandlerTypeDef.
+  * @param  Context paced transfer handle
+  * @param  SyncOverruns DMAMUX_CSR snapshot (unused)
+  * @param  GenOverruns DMAMUX_RGSR snapshot
+  * @retval None
+  */
+void DMAPACE_OverrunFlagsHandler(void *Context, uint32_t SyncOverruns, uint32_t GenOverruns)
+{
+  DMAPACE_HandleTypeDef *hpace = (DMAPACE_HandleTypeDef *)Context;
+
+  (void)SyncOverruns;
+  if ((GenOverruns & (1UL << hpace->Generator)) != 0UL)
+  {
+    DMAPACE_ReportOverrun(hpace);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
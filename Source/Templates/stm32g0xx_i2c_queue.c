@@ -0,0 +1,544 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2c_queue.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx I2C master DMA transaction queue.
+  *
+  *   This file provides:
+  *      - I2CQ_AddDevice() / I2CQ_Submit(): per-device queues, served round
+  *                                          robin.
+  *
+  *      - I2CQ_IRQHandler(): phase sequencing on the I2C events:
+  *           TCR   -> next NBYTES chunk (RELOAD)
+  *           TC    -> repeated start for the read phase
+  *           NACKF -> STOP if not automatic, transaction marked failed
+  *           STOPF -> completion, next transaction, callback
+  *
+  *      - I2CQ_DmaFlagsHandler(): DMA transfer errors.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2c_queue
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_I2C_Queue_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_i2c_queue.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Queue_Private_Defines
+  * @{
+  */
+
+/* Byte transfers; EN is added per phase */
+#define I2CQ_TX_CCR            (DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_TEIE)
+#define I2CQ_RX_CCR            (DMA_CCR_MINC | DMA_CCR_TEIE)
+
+#define I2CQ_CR1_IT            (I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE)
+#define I2CQ_ISR_ERRORS        (I2C_ISR_BERR | I2C_ISR_ARLO | I2C_ISR_OVR)
+#define I2CQ_ICR_ERRORS        (I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Queue_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Read the time base.
+  * @param  hi2cq queue handle
+  * @retval Counter value, 0 without time base
+  */
+static uint32_t I2CQ_Now(const I2CQ_HandleTypeDef *hi2cq)
+{
+  return (hi2cq->TimeBase != NULL) ? *hi2cq->TimeBase : 0UL;
+}
+
+/**
+  * @brief  Take the next NBYTES chunk of the current phase.
+  * @note   The phase end bits are set on every chunk: AUTOEND is ignored
+  *         while RELOAD is set.
+  * @param  hi2cq queue handle
+  * @retval CR2 NBYTES, RELOAD and AUTOEND bits
+  */
+static uint32_t I2CQ_Chunk(I2CQ_HandleTypeDef *hi2cq)
+{
+  uint32_t nbytes = hi2cq->Remaining;
+
+  if (nbytes > I2CQ_CHUNK_MAX)
+  {
+    nbytes = I2CQ_CHUNK_MAX;
+  }
+  hi2cq->Remaining -= nbytes;
+
+  return (nbytes << I2C_CR2_NBYTES_Pos) | hi2cq->PhaseEnd | ((hi2cq->Remaining != 0UL) ? I2C_CR2_RELOAD : 0UL);
+}
+
+/**
+  * @brief  Start the read phase of the current transaction.
+  * @note   Used for a plain read and as repeated start after a write.
+  * @param  hi2cq queue handle
+  * @retval None
+  */
+static void I2CQ_StartRead(I2CQ_HandleTypeDef *hi2cq)
+{
+  const I2CQ_TransactionTypeDef *t = hi2cq->Current;
+  DMA_Channel_TypeDef *rx = hi2cq->RxChannel;
+
+  hi2cq->TxChannel->CCR = 0UL;
+  rx->CMAR = (uint32_t)t->RxData;
+  rx->CNDTR = t->RxLength;
+  rx->CCR = I2CQ_RX_CCR | hi2cq->Priority | DMA_CCR_EN;
+
+  hi2cq->Remaining = t->RxLength;
+  hi2cq->PhaseEnd = I2C_CR2_AUTOEND;
+  hi2cq->Instance->CR2 = ((hi2cq->CurrentDevice->Address << 1U) & I2C_CR2_SADD) | I2C_CR2_RD_WRN |
+                         I2CQ_Chunk(hi2cq) | I2C_CR2_START;
+}
+
+/**
+  * @brief  Start the current transaction.
+  * @param  hi2cq queue handle
+  * @retval None
+  */
+static void I2CQ_Launch(I2CQ_HandleTypeDef *hi2cq)
+{
+  I2CQ_TransactionTypeDef *t = hi2cq->Current;
+  DMA_Channel_TypeDef *tx = hi2cq->TxChannel;
+  uint32_t sadd = (hi2cq->CurrentDevice->Address << 1U) & I2C_CR2_SADD;
+
+  t->Error = I2CQ_ERROR_NONE;
+  hi2cq->StartStamp = I2CQ_Now(hi2cq);
+
+  if (t->TxLength != 0U)
+  {
+    tx->CMAR = (uint32_t)t->TxData;
+    tx->CNDTR = t->TxLength;
+    tx->CCR = I2CQ_TX_CCR | hi2cq->Priority | DMA_CCR_EN;
+
+    /* Without read phase the STOP is automatic, otherwise TC is raised */
+    hi2cq->Remaining = t->TxLength;
+    hi2cq->PhaseEnd = (t->RxLength == 0U) ? I2C_CR2_AUTOEND : 0UL;
+    hi2cq->Instance->CR2 = sadd | I2CQ_Chunk(hi2cq) | I2C_CR2_START;
+  }
+  else if (t->RxLength != 0U)
+  {
+    I2CQ_StartRead(hi2cq);
+  }
+  else
+  {
+    /* Address probe */
+    hi2cq->Remaining = 0UL;
+    hi2cq->PhaseEnd = I2C_CR2_AUTOEND;
+    hi2cq->Instance->CR2 = sadd | I2C_CR2_AUTOEND | I2C_CR2_START;
+  }
+}
+
+/**
+  * @brief  Pick the next transaction, round robin over the devices.
+  * @param  hi2cq queue handle
+  * @retval None
+  */
+static void I2CQ_Schedule(I2CQ_HandleTypeDef *hi2cq)
+{
+  I2CQ_DeviceTypeDef *device = hi2cq->Cursor;
+  I2CQ_TransactionTypeDef *t;
+
+  hi2cq->Current = NULL;
+  if (device == NULL)
+  {
+    return;
+  }
+
+  /* Start after the last served device, which is checked last */
+  do
+  {
+    device = device->Next;
+    t = device->Head;
+    if (t != NULL)
+    {
+      device->Head = t->Next;
+      if (device->Head == NULL)
+      {
+        device->Tail = NULL;
+      }
+      hi2cq->Cursor = device;
+      hi2cq->CurrentDevice = device;
+      hi2cq->Current = t;
+      I2CQ_Launch(hi2cq);
+      return;
+    }
+  } while (device != hi2cq->Cursor);
+}
+
+/**
+  * @brief  Retire the running transaction and launch the next one.
+  * @param  hi2cq queue handle
+  * @retval None
+  */
+static void I2CQ_Complete(I2CQ_HandleTypeDef *hi2cq)
+{
+  I2CQ_TransactionTypeDef *done = hi2cq->Current;
+  uint32_t end = I2CQ_Now(hi2cq);
+  uint32_t latency;
+
+  hi2cq->TxChannel->CCR = 0UL;
+  hi2cq->RxChannel->CCR = 0UL;
+  if (done == NULL)
+  {
+    return;
+  }
+
+  hi2cq->Stats.BusyTicks += (end - hi2cq->StartStamp) & hi2cq->TimeBaseMask;
+  latency = (end - done->SubmitStamp) & hi2cq->TimeBaseMask;
+  hi2cq->Stats.LastLatency = latency;
+  if (latency > hi2cq->Stats.MaxLatency)
+  {
+    hi2cq->Stats.MaxLatency = latency;
+  }
+
+  /* Keep the bus busy: next transaction before any callback */
+  I2CQ_Schedule(hi2cq);
+
+  if (done->Error == I2CQ_ERROR_NONE)
+  {
+    hi2cq->Stats.Transactions++;
+    hi2cq->Stats.Bytes += (uint32_t)done->TxLength + (uint32_t)done->RxLength;
+  }
+  if (done->Callback != NULL)
+  {
+    done->Callback(done, (done->Error == I2CQ_ERROR_NONE) ? SUCCESS : ERROR);
+  }
+}
+
+/**
+  * @brief  Abort the running transaction after an error without STOP.
+  * @note   Clearing PE resets the I2C state machine and flags; the
+  *         read-back keeps PE low for more than 3 APB clock cycles.
+  * @param  hi2cq queue handle
+  * @param  Error I2CQ_ERROR_xx
+  * @retval None
+  */
+static void I2CQ_Abort(I2CQ_HandleTypeDef *hi2cq, uint32_t Error)
+{
+  I2C_TypeDef *i2c = hi2cq->Instance;
+
+  hi2cq->TxChannel->CCR = 0UL;
+  hi2cq->RxChannel->CCR = 0UL;
+  CLEAR_BIT(i2c->CR1, I2C_CR1_PE);
+  while ((i2c->CR1 & I2C_CR1_PE) != 0UL)
+  {
+  }
+  (void)i2c->CR1;
+  (void)i2c->CR1;
+  SET_BIT(i2c->CR1, I2C_CR1_PE);
+
+  if (hi2cq->Current != NULL)
+  {
+    hi2cq->Current->Error |= Error;
+  }
+  I2CQ_Complete(hi2cq);
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Queue_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the queue and enable the I2C.
+  * @param  hi2cq queue handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus I2CQ_Init(I2CQ_HandleTypeDef *hi2cq)
+{
+  I2C_TypeDef *i2c;
+
+  if ((hi2cq == NULL) || (hi2cq->Instance == NULL) ||
+      (hi2cq->TxChannel == NULL) || (hi2cq->RxChannel == NULL) || (hi2cq->TxChannel == hi2cq->RxChannel) ||
+      ((hi2cq->Priority & ~DMA_CCR_PL) != 0UL) ||
+      ((hi2cq->TimeBase != NULL) && (hi2cq->TimeBaseMask == 0UL)))
+  {
+    return ERROR;
+  }
+
+  i2c = hi2cq->Instance;
+
+  DMA_UTIL_EnableClock(hi2cq->TxChannel);
+  DMA_UTIL_EnableClock(hi2cq->RxChannel);
+  hi2cq->TxChannel->CCR = 0UL;
+  hi2cq->RxChannel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hi2cq->TxChannel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_ClearFlags(hi2cq->RxChannel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(hi2cq->TxChannel)->CCR =
+    (hi2cq->TxRequest << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  DMA_UTIL_GetMuxChannel(hi2cq->RxChannel)->CCR =
+    (hi2cq->RxRequest << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  hi2cq->TxChannel->CPAR = (uint32_t)&i2c->TXDR;
+  hi2cq->RxChannel->CPAR = (uint32_t)&i2c->RXDR;
+
+  hi2cq->Cursor = NULL;
+  hi2cq->Current = NULL;
+  hi2cq->CurrentDevice = NULL;
+  hi2cq->Remaining = 0UL;
+  I2CQ_ResetStats(hi2cq);
+
+  /* Event and error interrupts only, data move through DMA */
+  CLEAR_BIT(i2c->CR1, I2C_CR1_PE);
+  i2c->CR2 = 0UL;
+  MODIFY_REG(i2c->CR1, I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_ADDRIE,
+             I2CQ_CR1_IT | I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+  SET_BIT(i2c->CR1, I2C_CR1_PE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Register a device.
+  * @note   Devices are never removed; register each one once.
+  * @param  hi2cq queue handle
+  * @param  Device device with Address set
+  * @retval SUCCESS or ERROR on an invalid address
+  */
+ErrorStatus I2CQ_AddDevice(I2CQ_HandleTypeDef *hi2cq, I2CQ_DeviceTypeDef *Device)
+{
+  uint32_t primask;
+
+  if ((Device == NULL) || (Device->Address > 0x7FUL))
+  {
+    return ERROR;
+  }
+  Device->Head = NULL;
+  Device->Tail = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (hi2cq->Cursor == NULL)
+  {
+    Device->Next = Device;
+    hi2cq->Cursor = Device;
+  }
+  else
+  {
+    Device->Next = hi2cq->Cursor->Next;
+    hi2cq->Cursor->Next = Device;
+  }
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Queue a transaction for a device.
+  * @param  hi2cq queue handle
+  * @param  Device registered device
+  * @param  Transaction transaction, owned by the queue until its callback
+  * @retval SUCCESS or ERROR on an invalid transaction
+  */
+ErrorStatus I2CQ_Submit(I2CQ_HandleTypeDef *hi2cq, I2CQ_DeviceTypeDef *Device,
+                        I2CQ_TransactionTypeDef *Transaction)
+{
+  uint32_t primask;
+
+  if ((Device == NULL) || (Device->Next == NULL) || (Transaction == NULL) ||
+      ((Transaction->TxLength != 0U) && (Transaction->TxData == NULL)) ||
+      ((Transaction->RxLength != 0U) && (Transaction->RxData == NULL)))
+  {
+    return ERROR;
+  }
+  Transaction->Next = NULL;
+  Transaction->Error = I2CQ_ERROR_NONE;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  Transaction->SubmitStamp = I2CQ_Now(hi2cq);
+  if (Device->Head == NULL)
+  {
+    Device->Head = Transaction;
+  }
+  else
+  {
+    Device->Tail->Next = Transaction;
+  }
+  Device->Tail = Transaction;
+  if (hi2cq->Current == NULL)
+  {
+    I2CQ_Schedule(hi2cq);
+  }
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Tell whether no transaction is running.
+  * @param  hi2cq queue handle
+  * @retval 1 when idle, 0 otherwise
+  */
+uint32_t I2CQ_IsIdle(const I2CQ_HandleTypeDef *hi2cq)
+{
+  return (hi2cq->Current == NULL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Handle the I2C event and error interrupts.
+  * @param  hi2cq queue handle
+  * @retval None
+  */
+void I2CQ_IRQHandler(I2CQ_HandleTypeDef *hi2cq)
+{
+  I2C_TypeDef *i2c = hi2cq->Instance;
+  I2CQ_TransactionTypeDef *t = hi2cq->Current;
+  uint32_t isr = i2c->ISR;
+
+  if ((isr & I2CQ_ISR_ERRORS) != 0UL)
+  {
+    i2c->ICR = I2CQ_ICR_ERRORS;
+    hi2cq->Stats.BusErrors++;
+    I2CQ_Abort(hi2cq, I2CQ_ERROR_BUS);
+    return;
+  }
+  if (t == NULL)
+  {
+    i2c->ICR = I2C_ICR_NACKCF | I2C_ICR_STOPCF;
+    return;
+  }
+
+  if ((isr & I2C_ISR_NACKF) != 0UL)
+  {
+    i2c->ICR = I2C_ICR_NACKCF;
+    hi2cq->Stats.Nacks++;
+    t->Error |= I2CQ_ERROR_NACK;
+    hi2cq->TxChannel->CCR = 0UL;
+    /* STOP is only automatic with AUTOEND and no pending reload */
+    if ((i2c->CR2 & (I2C_CR2_AUTOEND | I2C_CR2_RELOAD)) != I2C_CR2_AUTOEND)
+    {
+      SET_BIT(i2c->CR2, I2C_CR2_STOP);
+    }
+    /* Flush a byte already loaded by the DMA */
+    i2c->ISR = I2C_ISR_TXE;
+  }
+  else if ((isr & I2C_ISR_TCR) != 0UL)
+  {
+    /* Writing NBYTES clears TCR */
+    MODIFY_REG(i2c->CR2, I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_AUTOEND, I2CQ_Chunk(hi2cq));
+  }
+  else if ((isr & I2C_ISR_TC) != 0UL)
+  {
+    if ((hi2cq->PhaseEnd == 0UL) && (t->RxLength != 0U))
+    {
+      /* End of the write phase: repeated start, which clears TC */
+      I2CQ_StartRead(hi2cq);
+    }
+    else
+    {
+      SET_BIT(i2c->CR2, I2C_CR2_STOP);
+    }
+  }
+  else
+  {
+    /* STOP only */
+  }
+
+  if ((isr & I2C_ISR_STOPF) != 0UL)
+  {
+    i2c->ICR = I2C_ICR_STOPCF;
+    I2CQ_Complete(hi2cq);
+  }
+}
+
+/**
+  * @brief  Handle the DMA interrupt(s) of both channels.
+  * @param  hi2cq queue handle
+  * @retval None
+  */
+void I2CQ_DMA_IRQHandler(I2CQ_HandleTypeDef *hi2cq)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hi2cq->TxChannel) | DMA_UTIL_GetFlags(hi2cq->RxChannel);
+
+  if ((flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hi2cq->TxChannel, DMA_UTIL_FLAG_ALL);
+    DMA_UTIL_ClearFlags(hi2cq->RxChannel, DMA_UTIL_FLAG_ALL);
+    I2CQ_DmaFlagsHandler(hi2cq, flags);
+  }
+}
+
+/**
+  * @brief  Process flags of either channel already read and cleared by the
+  *         caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef. Only errors are enabled
+  *         on the channels.
+  * @param  Context queue handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void I2CQ_DmaFlagsHandler(void *Context, uint32_t Flags)
+{
+  I2CQ_HandleTypeDef *hi2cq = (I2CQ_HandleTypeDef *)Context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hi2cq->Stats.DmaErrors++;
+    I2CQ_Abort(hi2cq, I2CQ_ERROR_DMA);
+  }
+}
+
+/**
+  * @brief  Reset the statistics.
+  * @param  hi2cq queue handle
+  * @retval None
+  */
+void I2CQ_ResetStats(I2CQ_HandleTypeDef *hi2cq)
+{
+  hi2cq->Stats.Transactions = 0UL;
+  hi2cq->Stats.Bytes = 0UL;
+  hi2cq->Stats.Nacks = 0UL;
+  hi2cq->Stats.BusErrors = 0UL;
+  hi2cq->Stats.DmaErrors = 0UL;
+  hi2cq->Stats.BusyTicks = 0UL;
+  hi2cq->Stats.LastLatency = 0UL;
+  hi2cq->Stats.MaxLatency = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
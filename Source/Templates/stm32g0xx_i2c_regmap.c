@@ -0,0 +1,469 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2c_regmap.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx I2C slave register map.
+  *
+  *   This file provides:
+  *      - I2CREG_IRQHandler(): address, offset byte and STOP handling; the
+  *                             DMA windows are set up on these events:
+  *           ADDR write -> offset byte by RXNE, then receive DMA into
+  *                         WriteMap[offset]
+  *           ADDR read  -> transmit DMA from the published snapshot at
+  *                         offset
+  *           STOPF      -> windows closed, write callback
+  *
+  *      - I2CREG_TxFlagsHandler() / I2CREG_RxFlagsHandler(): end of a
+  *                             window, the remaining bytes go through the
+  *                             interrupt as fill or discarded bytes.
+  *
+  *      - I2CREG_BeginUpdate() / I2CREG_Publish(): snapshot double
+  *                             buffering.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2c_regmap
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_i2c_regmap.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Private_Defines
+  * @{
+  */
+
+/* Transfer phases */
+#define I2CREG_PHASE_IDLE      (0UL)
+#define I2CREG_PHASE_OFFSET    (1UL)   /* Waiting for the offset byte       */
+#define I2CREG_PHASE_WRITE     (2UL)   /* Data bytes of a host write        */
+#define I2CREG_PHASE_READ      (3UL)   /* Host read                         */
+
+#define I2CREG_NONE            (2UL)   /* No snapshot being read            */
+
+/* Byte transfers with transfer complete at the end of the window */
+#define I2CREG_TX_CCR          (DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_TCIE | DMA_CCR_TEIE)
+#define I2CREG_RX_CCR          (DMA_CCR_MINC | DMA_CCR_TCIE | DMA_CCR_TEIE)
+
+#define I2CREG_ISR_ERRORS      (I2C_ISR_BERR | I2C_ISR_ARLO | I2C_ISR_OVR)
+#define I2CREG_ICR_ERRORS      (I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Close the write window and report the bytes stored.
+  * @param  hreg register map handle
+  * @retval None
+  */
+static void I2CREG_EndWrite(I2CREG_HandleTypeDef *hreg)
+{
+  uint32_t length = 0UL;
+
+  if ((hreg->Phase != I2CREG_PHASE_OFFSET) && (hreg->Phase != I2CREG_PHASE_WRITE))
+  {
+    return;
+  }
+  CLEAR_BIT(hreg->Instance->CR1, I2C_CR1_RXDMAEN | I2C_CR1_RXIE);
+  if (hreg->Window != 0UL)
+  {
+    length = hreg->Window - (hreg->RxChannel->CNDTR & DMA_CNDTR_NDT);
+    hreg->RxChannel->CCR = 0UL;
+    DMA_UTIL_ClearFlags(hreg->RxChannel, DMA_UTIL_FLAG_ALL);
+    hreg->Window = 0UL;
+  }
+  hreg->Phase = I2CREG_PHASE_IDLE;
+
+  if (length != 0UL)
+  {
+    hreg->Stats.Writes++;
+    hreg->Stats.WriteBytes += length;
+    if (hreg->WriteCallback != NULL)
+    {
+      hreg->WriteCallback(hreg, hreg->Offset, length);
+    }
+  }
+}
+
+/**
+  * @brief  Close the read window.
+  * @param  hreg register map handle
+  * @retval None
+  */
+static void I2CREG_EndRead(I2CREG_HandleTypeDef *hreg)
+{
+  CLEAR_BIT(hreg->Instance->CR1, I2C_CR1_TXDMAEN | I2C_CR1_TXIE);
+  hreg->TxChannel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hreg->TxChannel, DMA_UTIL_FLAG_ALL);
+  /* Drop the byte prefetched for a read the host ended with NACK */
+  hreg->Instance->ISR = I2C_ISR_TXE;
+  hreg->Reading = I2CREG_NONE;
+  if (hreg->Phase == I2CREG_PHASE_READ)
+  {
+    hreg->Phase = I2CREG_PHASE_IDLE;
+  }
+}
+
+/**
+  * @brief  Start a host read at the current offset.
+  * @param  hreg register map handle
+  * @retval None
+  */
+static void I2CREG_StartRead(I2CREG_HandleTypeDef *hreg)
+{
+  I2C_TypeDef *i2c = hreg->Instance;
+  DMA_Channel_TypeDef *tx = hreg->TxChannel;
+  uint32_t front = hreg->Front;
+
+  hreg->Reading = front;
+  hreg->Phase = I2CREG_PHASE_READ;
+  hreg->Stats.Reads++;
+  i2c->ISR = I2C_ISR_TXE;
+
+  if (hreg->Offset < hreg->ReadSize)
+  {
+    tx->CMAR = (uint32_t)&hreg->Snapshot[front][hreg->Offset];
+    tx->CNDTR = hreg->ReadSize - hreg->Offset;
+    tx->CCR = I2CREG_TX_CCR | DMA_CCR_EN;
+    SET_BIT(i2c->CR1, I2C_CR1_TXDMAEN);
+  }
+  else
+  {
+    SET_BIT(i2c->CR1, I2C_CR1_TXIE);
+  }
+}
+
+/**
+  * @brief  Open the write window once the offset byte is known.
+  * @param  hreg register map handle
+  * @param  Offset register offset sent by the host
+  * @retval None
+  */
+static void I2CREG_StartWrite(I2CREG_HandleTypeDef *hreg, uint32_t Offset)
+{
+  I2C_TypeDef *i2c = hreg->Instance;
+  DMA_Channel_TypeDef *rx = hreg->RxChannel;
+
+  hreg->Offset = Offset;
+  hreg->Phase = I2CREG_PHASE_WRITE;
+  hreg->Window = 0UL;
+
+  if (Offset < hreg->WriteSize)
+  {
+    hreg->Window = hreg->WriteSize - Offset;
+    rx->CMAR = (uint32_t)&hreg->WriteMap[Offset];
+    rx->CNDTR = hreg->Window;
+    rx->CCR = I2CREG_RX_CCR | DMA_CCR_EN;
+    MODIFY_REG(i2c->CR1, I2C_CR1_RXIE, I2C_CR1_RXDMAEN);
+  }
+  /* Otherwise data bytes keep coming through RXNE and are discarded */
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Regmap_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the slave and enable the I2C.
+  * @note   Snapshot[0] is published first; both buffers should hold the
+  *         initial register values.
+  * @param  hreg register map handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus I2CREG_Init(I2CREG_HandleTypeDef *hreg)
+{
+  I2C_TypeDef *i2c;
+
+  if ((hreg == NULL) || (hreg->Instance == NULL) || (hreg->OwnAddress > 0x7FUL) ||
+      (hreg->TxChannel == NULL) || (hreg->RxChannel == NULL) || (hreg->TxChannel == hreg->RxChannel) ||
+      (hreg->Snapshot[0] == NULL) || (hreg->Snapshot[1] == NULL) ||
+      (hreg->ReadSize == 0UL) || (hreg->ReadSize > I2CREG_MAP_MAX) ||
+      (hreg->WriteSize > I2CREG_MAP_MAX) || ((hreg->WriteSize != 0UL) && (hreg->WriteMap == NULL)))
+  {
+    return ERROR;
+  }
+
+  i2c = hreg->Instance;
+
+  DMA_UTIL_EnableClock(hreg->TxChannel);
+  DMA_UTIL_EnableClock(hreg->RxChannel);
+  hreg->TxChannel->CCR = 0UL;
+  hreg->RxChannel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hreg->TxChannel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_ClearFlags(hreg->RxChannel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(hreg->TxChannel)->CCR =
+    (hreg->TxRequest << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  DMA_UTIL_GetMuxChannel(hreg->RxChannel)->CCR =
+    (hreg->RxRequest << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  hreg->TxChannel->CPAR = (uint32_t)&i2c->TXDR;
+  hreg->RxChannel->CPAR = (uint32_t)&i2c->RXDR;
+
+  hreg->Front = 0UL;
+  hreg->Reading = I2CREG_NONE;
+  hreg->Phase = I2CREG_PHASE_IDLE;
+  hreg->Offset = 0UL;
+  hreg->Window = 0UL;
+  I2CREG_ResetStats(hreg);
+
+  /* Slave with clock stretching; data interrupts and DMA requests are
+     enabled per phase */
+  CLEAR_BIT(i2c->CR1, I2C_CR1_PE);
+  CLEAR_BIT(i2c->OAR1, I2C_OAR1_OA1EN);
+  i2c->OAR1 = I2C_OAR1_OA1EN | ((hreg->OwnAddress << 1U) & I2C_OAR1_OA1);
+  MODIFY_REG(i2c->CR1,
+             I2C_CR1_NOSTRETCH | I2C_CR1_SBC | I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TCIE |
+             I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN,
+             I2C_CR1_ADDRIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE);
+  SET_BIT(i2c->CR1, I2C_CR1_PE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Get the back snapshot, initialized from the published one.
+  * @note   Returns NULL while a host read still uses the back buffer (it
+  *         was published before); retry later. Modify the returned buffer
+  *         then call I2CREG_Publish().
+  * @param  hreg register map handle
+  * @retval Back buffer of ReadSize bytes, or NULL when busy
+  */
+uint8_t *I2CREG_BeginUpdate(I2CREG_HandleTypeDef *hreg)
+{
+  uint32_t front = hreg->Front;
+  uint32_t back = front ^ 1UL;
+  const uint8_t *src;
+  uint8_t *dst;
+  uint32_t i;
+
+  if (hreg->Reading == back)
+  {
+    hreg->Stats.UpdateBusy++;
+    return NULL;
+  }
+
+  /* The interrupt only reads the front buffer, which is left untouched */
+  src = hreg->Snapshot[front];
+  dst = hreg->Snapshot[back];
+  for (i = 0UL; i < hreg->ReadSize; i++)
+  {
+    dst[i] = src[i];
+  }
+  return dst;
+}
+
+/**
+  * @brief  Publish the back snapshot obtained by I2CREG_BeginUpdate().
+  * @note   A host read already started keeps its buffer until STOP.
+  * @param  hreg register map handle
+  * @retval None
+  */
+void I2CREG_Publish(I2CREG_HandleTypeDef *hreg)
+{
+  __DMB();
+  hreg->Front ^= 1UL;
+  hreg->Stats.Publishes++;
+}
+
+/**
+  * @brief  Handle the I2C event and error interrupts.
+  * @param  hreg register map handle
+  * @retval None
+  */
+void I2CREG_IRQHandler(I2CREG_HandleTypeDef *hreg)
+{
+  I2C_TypeDef *i2c = hreg->Instance;
+  uint32_t isr = i2c->ISR;
+  uint32_t cr1 = i2c->CR1;
+
+  if ((isr & I2CREG_ISR_ERRORS) != 0UL)
+  {
+    i2c->ICR = I2CREG_ICR_ERRORS;
+    hreg->Stats.Errors++;
+  }
+
+  /* Data through the interrupt: offset byte, discarded or fill bytes */
+  if (((isr & I2C_ISR_RXNE) != 0UL) && ((cr1 & I2C_CR1_RXIE) != 0UL))
+  {
+    if (hreg->Phase == I2CREG_PHASE_OFFSET)
+    {
+      I2CREG_StartWrite(hreg, i2c->RXDR);
+    }
+    else
+    {
+      (void)i2c->RXDR;
+      hreg->Stats.Overflows++;
+    }
+  }
+  if (((isr & I2C_ISR_TXIS) != 0UL) && ((cr1 & I2C_CR1_TXIE) != 0UL))
+  {
+    i2c->TXDR = I2CREG_FILL_BYTE;
+    hreg->Stats.Overflows++;
+  }
+
+  if ((isr & I2C_ISR_NACKF) != 0UL)
+  {
+    /* End of a host read */
+    i2c->ICR = I2C_ICR_NACKCF;
+  }
+
+  if ((isr & I2C_ISR_STOPF) != 0UL)
+  {
+    i2c->ICR = I2C_ICR_STOPCF;
+    I2CREG_EndWrite(hreg);
+    I2CREG_EndRead(hreg);
+  }
+
+  /* New transfer, or repeated start: the clock is stretched until ADDRCF */
+  if ((isr & I2C_ISR_ADDR) != 0UL)
+  {
+    I2CREG_EndWrite(hreg);
+    I2CREG_EndRead(hreg);
+    if ((isr & I2C_ISR_DIR) != 0UL)
+    {
+      I2CREG_StartRead(hreg);
+    }
+    else
+    {
+      hreg->Phase = I2CREG_PHASE_OFFSET;
+      SET_BIT(i2c->CR1, I2C_CR1_RXIE);
+    }
+    i2c->ICR = I2C_ICR_ADDRCF;
+  }
+}
+
+/**
+  * @brief  Handle the DMA interrupt(s) of both channels.
+  * @param  hreg register map handle
+  * @retval None
+  */
+void I2CREG_DMA_IRQHandler(I2CREG_HandleTypeDef *hreg)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hreg->TxChannel);
+
+  if ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hreg->TxChannel, flags);
+    I2CREG_TxFlagsHandler(hreg, flags);
+  }
+
+  flags = DMA_UTIL_GetFlags(hreg->RxChannel);
+  if ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hreg->RxChannel, flags);
+    I2CREG_RxFlagsHandler(hreg, flags);
+  }
+}
+
+/**
+  * @brief  Process read map channel flags already read and cleared by the
+  *         caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef. At the end of the read
+  *         map the interrupt sends I2CREG_FILL_BYTE.
+  * @param  Context register map handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void I2CREG_TxFlagsHandler(void *Context, uint32_t Flags)
+{
+  I2CREG_HandleTypeDef *hreg = (I2CREG_HandleTypeDef *)Context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hreg->Stats.Errors++;
+  }
+  /* Ignore a late event of a window already closed */
+  if (((Flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL) &&
+      ((hreg->Instance->CR1 & I2C_CR1_TXDMAEN) != 0UL))
+  {
+    MODIFY_REG(hreg->Instance->CR1, I2C_CR1_TXDMAEN, I2C_CR1_TXIE);
+  }
+}
+
+/**
+  * @brief  Process write window channel flags already read and cleared by
+  *         the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef. Once the window is
+  *         full the interrupt discards the bytes; the callback still runs
+  *         at STOP.
+  * @param  Context register map handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void I2CREG_RxFlagsHandler(void *Context, uint32_t Flags)
+{
+  I2CREG_HandleTypeDef *hreg = (I2CREG_HandleTypeDef *)Context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hreg->Stats.Errors++;
+  }
+  /* Ignore a late event of a window already closed */
+  if (((Flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL) &&
+      ((hreg->Instance->CR1 & I2C_CR1_RXDMAEN) != 0UL))
+  {
+    MODIFY_REG(hreg->Instance->CR1, I2C_CR1_RXDMAEN, I2C_CR1_RXIE);
+  }
+}
+
+/**
+  * @brief  Reset the statistics.
+  * @param  hreg register map handle
+  * @retval None
+  */
+void I2CREG_ResetStats(I2CREG_HandleTypeDef *hreg)
+{
+  hreg->Stats.Reads = 0UL;
+  hreg->Stats.Writes = 0UL;
+  hreg->Stats.WriteBytes = 0UL;
+  hreg->Stats.Overflows = 0UL;
+  hreg->Stats.Publishes = 0UL;
+  hreg->Stats.UpdateBusy = 0UL;
+  hreg->Stats.Errors = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
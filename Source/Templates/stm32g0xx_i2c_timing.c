@@ -0,0 +1,408 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2c_timing.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx precomputed I2C TIMINGR tables.
+  *
+  *   This file provides:
+  *      - Constant TIMINGR tables for 100 kHz, 400 kHz and 1 MHz at the
+  *        usual kernel clocks, filled by the compiler from the
+  *        I2CTIMING_TIMINGR() macro.
+  *
+  *      - I2CTIMING_Lookup() / I2CTIMING_Set(): table row cached per
+  *        instance and revalidated against the kernel clock on each call;
+  *        a row for an unlisted clock is computed once by an out-of-line
+  *        copy of the solver.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2c_timing
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_i2c_timing.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Private_Defines
+  * @{
+  */
+
+#if !defined  (HSI_VALUE)
+  #define HSI_VALUE  (16000000UL)   /*!< Value of the Internal oscillator in Hz*/
+#endif /* HSI_VALUE */
+
+/* Kernel clock selections, RCC_CCIPR I2CxSEL encoding */
+#define I2CTIMING_SEL_PCLK     (0UL)
+#define I2CTIMING_SEL_SYSCLK   (1UL)
+#define I2CTIMING_SEL_HSI16    (2UL)
+
+/* Table entries */
+#define I2CTIMING_ENTRY(FCK, SPEED, FT, FMIN, TLOW, THIGH, TSU, TR, TF) \
+  { I2CTIMING_TIMINGR(FCK, SPEED, FT, FMIN, TLOW, THIGH, TSU, TR, TF), \
+    ((I2CTIMING_TIMINGR(FCK, SPEED, FT, FMIN, TLOW, THIGH, TSU, TR, TF) == 0U) ? 0U : \
+     I2CTIMING_FREQUENCY(FCK, I2CTIMING_TIMINGR(FCK, SPEED, FT, FMIN, TLOW, THIGH, TSU, TR, TF), TR, TF)) },
+
+#define I2CTIMING_ROW(FCK)     { (FCK), { I2CTIMING_MODES(I2CTIMING_ENTRY, FCK) } }
+
+#define I2CTIMING_MODE_VALUE(ARG, SPEED, FT, FMIN, TLOW, THIGH, TSU, TR, TF) \
+  { (SPEED), (FT), (FMIN), (TLOW), (THIGH), (TSU), (TR), (TF) },
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Private_TypesDefinitions
+  * @{
+  */
+
+/* One line of I2CTIMING_MODES */
+typedef struct
+{
+  uint32_t Speed;
+  uint32_t TimingClock;
+  uint32_t MinClock;
+  uint32_t TLow;
+  uint32_t THigh;
+  uint32_t TSuDat;
+  uint32_t Tr;
+  uint32_t Tf;
+} I2CTIMING_ModeTypeDef;
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Private_Variables
+  * @{
+  */
+
+static const I2CTIMING_ModeTypeDef I2CTIMING_Modes[I2CTIMING_NB_MODES] =
+{
+  I2CTIMING_MODES(I2CTIMING_MODE_VALUE, 0U)
+};
+
+/* SYSCLK / PCLK operating points: PLL 64 and 48 MHz, HSI16 and its dividers */
+static const I2CTIMING_RowTypeDef I2CTIMING_Table[] =
+{
+  I2CTIMING_ROW(64000000UL),
+  I2CTIMING_ROW(48000000UL),
+  I2CTIMING_ROW(32000000UL),
+  I2CTIMING_ROW(24000000UL),
+  I2CTIMING_ROW(16000000UL),
+  I2CTIMING_ROW(8000000UL),
+  I2CTIMING_ROW(4000000UL),
+  I2CTIMING_ROW(2000000UL),
+  I2CTIMING_ROW(1000000UL),
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Timing clock periods covering a duration, as I2CTIMING_TICKS().
+  * @param  Clock kernel clock in Hz
+  * @param  Unit 10^9 times the prescaler division
+  * @param  Ns duration in ns
+  * @retval Number of periods, rounded up
+  */
+static uint32_t I2CTIMING_Ticks(uint32_t Clock, uint64_t Unit, uint32_t Ns)
+{
+  return (uint32_t)((((uint64_t)Ns * Clock) + Unit - 1U) / Unit);
+}
+
+/**
+  * @brief  Compute the TIMINGR value of one mode at a kernel clock.
+  * @note   Same results as I2CTIMING_TIMINGR() and I2CTIMING_FREQUENCY(),
+  *         with each term evaluated once: six 64-bit divisions
+  *         (__aeabi_uldivmod on the Cortex-M0+) and five 32-bit ones. Only
+  *         runs for kernel clocks missing from I2CTIMING_Table, once per
+  *         clock change.
+  * @param  Clock kernel clock in Hz
+  * @param  Mode bus mode parameters
+  * @param  Entry TIMINGR value and estimated SCL frequency, 0 when
+  *         unreachable
+  * @retval None
+  */
+static void I2CTIMING_Compute(uint32_t Clock, const I2CTIMING_ModeTypeDef *Mode, I2CTIMING_EntryTypeDef *Entry)
+{
+  uint32_t presc;
+  uint64_t unit;
+  uint32_t sum;
+  uint32_t share;
+  uint32_t low;
+  uint32_t high;
+  uint32_t scldel;
+  uint32_t sdacyc;
+  uint32_t sdadel;
+  uint64_t period;
+
+  Entry->Timingr = 0UL;
+  Entry->Frequency = 0UL;
+  if (Clock < Mode->MinClock)
+  {
+    return;
+  }
+
+  presc = I2CTIMING_CEIL(Clock, Mode->TimingClock);
+  presc = (presc > 16UL) ? 15UL : (presc - 1UL);
+  unit = (uint64_t)1000000000U * (presc + 1UL);
+
+  /* SCLL + SCLH + 2 in the ratio tLOW / tHIGH, each at least its minimum */
+  sum = I2CTIMING_Ticks(Clock, unit, (1000000000UL / Mode->Speed) - Mode->Tr - Mode->Tf - (2UL * I2CTIMING_AF_NS));
+  low = I2CTIMING_Ticks(Clock, unit, Mode->TLow);
+  share = I2CTIMING_CEIL(sum * Mode->TLow, Mode->TLow + Mode->THigh);
+  if (low <= share)
+  {
+    low = share;
+  }
+  high = I2CTIMING_Ticks(Clock, unit, Mode->THigh);
+  if (sum > (low + high))
+  {
+    high = sum - low;
+  }
+
+  scldel = I2CTIMING_Ticks(Clock, unit, Mode->Tr + Mode->TSuDat) - 1UL;
+  sdacyc = I2CTIMING_Ticks(Clock, 1000000000U, Mode->Tf - I2CTIMING_AF_NS);
+  sdadel = (sdacyc <= 3UL) ? 0UL : I2CTIMING_CEIL(sdacyc - 3UL, presc + 1UL);
+
+  if ((low > 256UL) || (high > 256UL) || (scldel > 15UL) || (sdadel > 15UL))
+  {
+    return;
+  }
+
+  Entry->Timingr = (presc << I2C_TIMINGR_PRESC_Pos) | (scldel << I2C_TIMINGR_SCLDEL_Pos) |
+                   (sdadel << I2C_TIMINGR_SDADEL_Pos) | ((high - 1UL) << I2C_TIMINGR_SCLH_Pos) |
+                   ((low - 1UL) << I2C_TIMINGR_SCLL_Pos);
+  period = I2CTIMING_DIV_ROUND((uint64_t)(low + high) * unit, (uint64_t)Clock);
+  Entry->Frequency = 1000000000UL / ((uint32_t)period + Mode->Tr + Mode->Tf + (2UL * I2CTIMING_AF_NS));
+}
+
+/**
+  * @brief  Revalidate the cached row against the current kernel clock.
+  * @param  htiming TIMINGR cache
+  * @retval None
+  */
+static void I2CTIMING_Refresh(I2CTIMING_HandleTypeDef *htiming)
+{
+  uint32_t clock = I2CTIMING_GetKernelClock(htiming->Instance);
+  uint32_t i;
+
+  if ((htiming->Row != NULL) && (clock == htiming->KernelClock))
+  {
+    return;
+  }
+
+  htiming->Stats.Rebuilds++;
+  htiming->KernelClock = clock;
+  htiming->Row = NULL;
+
+  for (i = 0UL; i < (sizeof(I2CTIMING_Table) / sizeof(I2CTIMING_Table[0])); i++)
+  {
+    if (I2CTIMING_Table[i].KernelClock == clock)
+    {
+      htiming->Row = &I2CTIMING_Table[i];
+      return;
+    }
+  }
+
+  /* Unlisted operating point: build the row once, same solver as the table */
+  htiming->Computed.KernelClock = clock;
+  for (i = 0UL; i < I2CTIMING_NB_MODES; i++)
+  {
+    I2CTIMING_Compute(clock, &I2CTIMING_Modes[i], &htiming->Computed.Entry[i]);
+  }
+  htiming->Row = &htiming->Computed;
+  htiming->Stats.RowsComputed++;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2C_Timing_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize a TIMINGR cache.
+  * @param  htiming TIMINGR cache
+  * @param  Instance I2C instance
+  * @retval SUCCESS or ERROR on an invalid parameter
+  */
+ErrorStatus I2CTIMING_Init(I2CTIMING_HandleTypeDef *htiming, I2C_TypeDef *Instance)
+{
+  if ((htiming == NULL) || (Instance == NULL))
+  {
+    return ERROR;
+  }
+
+  htiming->Instance = Instance;
+  htiming->KernelClock = 0UL;
+  htiming->Row = NULL;
+  htiming->Stats.Lookups = 0UL;
+  htiming->Stats.Rebuilds = 0UL;
+  htiming->Stats.RowsComputed = 0UL;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Return the kernel clock of an I2C instance.
+  * @note   Relies on SystemCoreClock being up to date. Instances without a
+  *         clock selection field run from PCLK.
+  * @param  Instance I2C instance
+  * @retval Kernel clock in Hz
+  */
+uint32_t I2CTIMING_GetKernelClock(const I2C_TypeDef *Instance)
+{
+  uint32_t ccipr = RCC->CCIPR;
+  uint32_t sel = I2CTIMING_SEL_PCLK;
+  uint32_t clock;
+
+  if (Instance == I2C1)
+  {
+    sel = (ccipr & RCC_CCIPR_I2C1SEL) >> RCC_CCIPR_I2C1SEL_Pos;
+  }
+#if defined(RCC_CCIPR_I2C2SEL)
+  else if (Instance == I2C2)
+  {
+    sel = (ccipr & RCC_CCIPR_I2C2SEL) >> RCC_CCIPR_I2C2SEL_Pos;
+  }
+#endif /* RCC_CCIPR_I2C2SEL */
+#if defined(RCC_CCIPR_I2C3SEL)
+  else if (Instance == I2C3)
+  {
+    sel = (ccipr & RCC_CCIPR_I2C3SEL) >> RCC_CCIPR_I2C3SEL_Pos;
+  }
+#endif /* RCC_CCIPR_I2C3SEL */
+  else
+  {
+    /* PCLK only */
+  }
+
+  switch (sel)
+  {
+    case I2CTIMING_SEL_SYSCLK:
+      clock = SystemCoreClock << AHBPrescTable[(RCC->CFGR & RCC_CFGR_HPRE) >> RCC_CFGR_HPRE_Pos];
+      break;
+    case I2CTIMING_SEL_HSI16:
+      clock = HSI_VALUE;
+      break;
+    default:
+      clock = SystemCoreClock >> APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE) >> RCC_CFGR_PPRE_Pos];
+      break;
+  }
+
+  return clock;
+}
+
+/**
+  * @brief  Return the TIMINGR value for a bus speed.
+  * @param  htiming TIMINGR cache
+  * @param  Speed 100000, 400000 or 1000000
+  * @param  Entry TIMINGR value and estimated SCL frequency
+  * @retval SUCCESS, or ERROR for another speed or an unreachable one
+  */
+ErrorStatus I2CTIMING_Lookup(I2CTIMING_HandleTypeDef *htiming, uint32_t Speed, I2CTIMING_EntryTypeDef *Entry)
+{
+  uint32_t i;
+
+  I2CTIMING_Refresh(htiming);
+  htiming->Stats.Lookups++;
+
+  for (i = 0UL; i < I2CTIMING_NB_MODES; i++)
+  {
+    if (I2CTIMING_Modes[i].Speed == Speed)
+    {
+      *Entry = htiming->Row->Entry[i];
+      return (Entry->Timingr != 0UL) ? SUCCESS : ERROR;
+    }
+  }
+
+  return ERROR;
+}
+
+/**
+  * @brief  Program TIMINGR for a bus speed.
+  * @note   The instance is disabled while TIMINGR is written, then restored;
+  *         no transfer must be in progress.
+  * @param  htiming TIMINGR cache
+  * @param  Speed 100000, 400000 or 1000000
+  * @param  Frequency estimated SCL frequency in Hz, may be NULL
+  * @retval SUCCESS, or ERROR for another speed or an unreachable one
+  */
+ErrorStatus I2CTIMING_Set(I2CTIMING_HandleTypeDef *htiming, uint32_t Speed, uint32_t *Frequency)
+{
+  I2C_TypeDef *i2c = htiming->Instance;
+  I2CTIMING_EntryTypeDef entry;
+  uint32_t pe;
+
+  if (I2CTIMING_Lookup(htiming, Speed, &entry) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  pe = i2c->CR1 & I2C_CR1_PE;
+  CLEAR_BIT(i2c->CR1, I2C_CR1_PE);
+  i2c->TIMINGR = entry.Timingr;
+  SET_BIT(i2c->CR1, pe);
+
+  if (Frequency != NULL)
+  {
+    *Frequency = entry.Frequency;
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Drop the cached row; the next lookup selects it again.
+  * @param  htiming TIMINGR cache
+  * @retval None
+  */
+void I2CTIMING_Invalidate(I2CTIMING_HandleTypeDef *htiming)
+{
+  htiming->Row = NULL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,470 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_i2s_stream.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx I2S double-buffered DMA streaming.
+  *
+  *   This file provides:
+  *      - I2SSTREAM_GetKernelClock(): I2S kernel clock of an instance, read
+  *                                    from the RCC clock selection.
+  *
+  *      - I2SSTREAM_Init() / Start() / Stop(): I2S and circular DMA setup,
+  *                                             prescaler from the sample
+  *                                             rate in master modes.
+  *
+  *      - I2SSTREAM_FlagsHandler(): half and full events, runs the refill
+  *                                  callback on the released half and checks
+  *                                  its deadline.
+  *
+  *      - I2SSTREAM_I2S_IRQHandler(): underrun and overrun accounting.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_i2s_stream
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_I2S_Stream_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_i2s_stream.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2S_Stream_Private_Defines
+  * @{
+  */
+
+#if !defined  (HSE_VALUE)
+  #define HSE_VALUE  (8000000UL)    /*!< Value of the External oscillator in Hz */
+#endif /* HSE_VALUE */
+
+#if !defined  (HSI_VALUE)
+  #define HSI_VALUE  (16000000UL)   /*!< Value of the Internal oscillator in Hz*/
+#endif /* HSI_VALUE */
+
+/* I2SxSEL encoding */
+#define I2SSTREAM_SEL_SYSCLK           (0UL)
+#define I2SSTREAM_SEL_PLLP             (1UL)
+#define I2SSTREAM_SEL_HSI16            (2UL)
+
+/* Serial clock periods per frame: 2 channels of 16 or 32 bits, or 256 with MCK */
+#define I2SSTREAM_FRAME_16BIT          (32UL)
+#define I2SSTREAM_FRAME_32BIT          (64UL)
+#define I2SSTREAM_FRAME_MCLK           (256UL)
+
+#define I2SSTREAM_HALF_MAX             (DMA_CNDTR_NDT / 2UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2S_Stream_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Tell whether the stream transmits.
+  * @param  hi2s stream handle
+  * @retval 1 for transmit modes, 0 for receive modes
+  */
+static uint32_t I2SSTREAM_IsTx(const I2SSTREAM_HandleTypeDef *hi2s)
+{
+  return ((hi2s->Mode & SPI_I2SCFGR_I2SCFG_0) == 0UL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Tell whether the stream drives the bit clock.
+  * @param  hi2s stream handle
+  * @retval 1 for master modes, 0 for slave modes
+  */
+static uint32_t I2SSTREAM_IsMaster(const I2SSTREAM_HandleTypeDef *hi2s)
+{
+  return ((hi2s->Mode & SPI_I2SCFGR_I2SCFG_1) != 0UL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  PLL "P" output frequency.
+  * @retval Frequency in Hz, 0 when the output is disabled
+  */
+static uint32_t I2SSTREAM_GetPllpClock(void)
+{
+  uint32_t pllcfgr = RCC->PLLCFGR;
+  uint32_t pllvco;
+  uint32_t pllm;
+  uint32_t pllp;
+
+  if ((pllcfgr & RCC_PLLCFGR_PLLPEN) == 0UL)
+  {
+    return 0UL;
+  }
+
+  pllm = ((pllcfgr & RCC_PLLCFGR_PLLM) >> RCC_PLLCFGR_PLLM_Pos) + 1UL;
+  if ((pllcfgr & RCC_PLLCFGR_PLLSRC) == 0x03UL) /* HSE used as PLL clock source */
+  {
+    pllvco = (HSE_VALUE / pllm);
+  }
+  else if ((pllcfgr & RCC_PLLCFGR_PLLSRC) == 0x02UL) /* HSI used as PLL clock source */
+  {
+    pllvco = (HSI_VALUE / pllm);
+  }
+  else
+  {
+    return 0UL;
+  }
+  pllvco = pllvco * ((pllcfgr & RCC_PLLCFGR_PLLN) >> RCC_PLLCFGR_PLLN_Pos);
+  pllp = ((pllcfgr & RCC_PLLCFGR_PLLP) >> RCC_PLLCFGR_PLLP_Pos) + 1UL;
+
+  return pllvco / pllp;
+}
+
+/**
+  * @brief  Compute and write the prescaler of a master stream.
+  * @param  hi2s stream handle
+  * @retval SUCCESS, or ERROR when the rate is out of the divider range
+  */
+static ErrorStatus I2SSTREAM_SetPrescaler(I2SSTREAM_HandleTypeDef *hi2s)
+{
+  uint32_t clock = hi2s->KernelClock;
+  uint32_t bits;
+  uint32_t frame;
+  uint32_t div;
+
+  if (clock == 0UL)
+  {
+    clock = I2SSTREAM_GetKernelClock(hi2s->Instance);
+  }
+  if ((clock == 0UL) || (hi2s->SampleRate == 0UL))
+  {
+    return ERROR;
+  }
+
+  if (hi2s->MclkOutput != 0UL)
+  {
+    bits = I2SSTREAM_FRAME_MCLK;
+  }
+  else if (hi2s->ChannelLength == I2SSTREAM_CHANNEL_32BIT)
+  {
+    bits = I2SSTREAM_FRAME_32BIT;
+  }
+  else
+  {
+    bits = I2SSTREAM_FRAME_16BIT;
+  }
+
+  /* Fs = clock / (bits * (2 * I2SDIV + ODD)), div is 2 * I2SDIV + ODD */
+  frame = bits * hi2s->SampleRate;
+  div = (clock + (frame / 2UL)) / frame;
+  if (((div >> 1U) < I2SSTREAM_DIV_MIN) || ((div >> 1U) > SPI_I2SPR_I2SDIV))
+  {
+    return ERROR;
+  }
+
+  hi2s->Instance->I2SPR = (div >> 1U) | ((div & 1UL) << SPI_I2SPR_ODD_Pos) |
+                          ((hi2s->MclkOutput != 0UL) ? SPI_I2SPR_MCKOE : 0UL);
+
+  hi2s->ActualRate = (clock + ((bits * div) / 2UL)) / (bits * div);
+  hi2s->RateErrorPpm = (int32_t)((((int64_t)clock * 1000000LL) / ((int64_t)frame * (int64_t)div)) - 1000000LL);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Hand one released half to the callback and check its deadline.
+  * @param  hi2s stream handle
+  * @param  Half 0 for the first half, 1 for the second
+  * @retval None
+  */
+static void I2SSTREAM_Refill(I2SSTREAM_HandleTypeDef *hi2s, uint32_t Half)
+{
+  uint32_t start = DMA_UTIL_CycleStamp();
+  uint32_t position;
+  uint32_t cycles;
+
+  hi2s->Callback(hi2s, &hi2s->Buffer[Half * hi2s->HalfSamples], hi2s->HalfSamples);
+
+  cycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+  hi2s->Stats.Halves++;
+  hi2s->Stats.LastCycles = cycles;
+  if (cycles > hi2s->Stats.MaxCycles)
+  {
+    hi2s->Stats.MaxCycles = cycles;
+  }
+
+  /* The DMA must still be in the other half */
+  position = (2UL * hi2s->HalfSamples) - (hi2s->Channel->CNDTR & DMA_CNDTR_NDT);
+  if ((position >= hi2s->HalfSamples) != (Half == 0UL))
+  {
+    hi2s->Stats.Late++;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_I2S_Stream_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Get the I2S kernel clock of an instance.
+  * @note   SYSCLK is derived from SystemCoreClock, which must be up to date.
+  * @param  Instance SPI instance
+  * @retval Frequency in Hz, 0 for I2S_CKIN, a disabled PLL output or an
+  *         instance without I2S clock selection
+  */
+uint32_t I2SSTREAM_GetKernelClock(const SPI_TypeDef *Instance)
+{
+  uint32_t sel;
+
+#if defined(RCC_CCIPR2_I2S2SEL)
+  if (Instance == SPI1)
+  {
+    sel = (RCC->CCIPR2 & RCC_CCIPR2_I2S1SEL) >> RCC_CCIPR2_I2S1SEL_Pos;
+  }
+  else if (Instance == SPI2)
+  {
+    sel = (RCC->CCIPR2 & RCC_CCIPR2_I2S2SEL) >> RCC_CCIPR2_I2S2SEL_Pos;
+  }
+#else
+  if (Instance == SPI1)
+  {
+    sel = (RCC->CCIPR & RCC_CCIPR_I2S1SEL) >> RCC_CCIPR_I2S1SEL_Pos;
+  }
+#endif /* RCC_CCIPR2_I2S2SEL */
+  else
+  {
+    return 0UL;
+  }
+
+  switch (sel)
+  {
+    case I2SSTREAM_SEL_SYSCLK:
+      return SystemCoreClock << AHBPrescTable[(RCC->CFGR & RCC_CFGR_HPRE) >> RCC_CFGR_HPRE_Pos];
+
+    case I2SSTREAM_SEL_PLLP:
+      return I2SSTREAM_GetPllpClock();
+
+    case I2SSTREAM_SEL_HSI16:
+      return HSI_VALUE;
+
+    default:
+      /* External I2S_CKIN pin, frequency unknown */
+      return 0UL;
+  }
+}
+
+/**
+  * @brief  Initialize the stream, left disabled.
+  * @note   16-bit data. In master modes the achieved rate and its error are
+  *         stored in ActualRate and RateErrorPpm.
+  * @param  hi2s stream handle
+  * @retval SUCCESS, or ERROR on an invalid configuration or an unreachable
+  *         sample rate
+  */
+ErrorStatus I2SSTREAM_Init(I2SSTREAM_HandleTypeDef *hi2s)
+{
+  SPI_TypeDef *spi;
+  DMA_Channel_TypeDef *channel;
+
+  if ((hi2s == NULL) || (hi2s->Instance == NULL) || (hi2s->Channel == NULL) ||
+      (hi2s->Buffer == NULL) || (hi2s->Callback == NULL) ||
+      (hi2s->HalfSamples == 0UL) || (hi2s->HalfSamples > I2SSTREAM_HALF_MAX))
+  {
+    return ERROR;
+  }
+
+  spi = hi2s->Instance;
+  channel = hi2s->Channel;
+
+  /* I2S: configuration is only written while disabled */
+  CLEAR_BIT(spi->I2SCFGR, SPI_I2SCFGR_I2SE);
+  spi->CR2 = 0UL;
+  spi->I2SCFGR = SPI_I2SCFGR_I2SMOD | hi2s->Mode | hi2s->Standard | hi2s->ChannelLength;
+
+  hi2s->ActualRate = 0UL;
+  hi2s->RateErrorPpm = 0;
+  if (I2SSTREAM_IsMaster(hi2s) != 0UL)
+  {
+    if (I2SSTREAM_SetPrescaler(hi2s) != SUCCESS)
+    {
+      return ERROR;
+    }
+  }
+  SET_BIT(spi->CR2, SPI_CR2_ERRIE);
+
+  /* DMA: half-words, circular over both halves */
+  DMA_UTIL_EnableClock(channel);
+  channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(channel)->CCR = (hi2s->Request << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  channel->CPAR = (uint32_t)&spi->DR;
+  channel->CMAR = (uint32_t)hi2s->Buffer;
+  channel->CNDTR = 2UL * hi2s->HalfSamples;
+  channel->CCR = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 |
+                 DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_TEIE |
+                 ((I2SSTREAM_IsTx(hi2s) != 0UL) ? DMA_CCR_DIR : 0UL);
+
+  I2SSTREAM_ResetStats(hi2s);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start streaming.
+  * @note   For transmit streams the callback fills both halves first.
+  * @param  hi2s stream handle
+  * @retval None
+  */
+void I2SSTREAM_Start(I2SSTREAM_HandleTypeDef *hi2s)
+{
+  SPI_TypeDef *spi = hi2s->Instance;
+
+  if (I2SSTREAM_IsTx(hi2s) != 0UL)
+  {
+    hi2s->Callback(hi2s, &hi2s->Buffer[0], hi2s->HalfSamples);
+    hi2s->Callback(hi2s, &hi2s->Buffer[hi2s->HalfSamples], hi2s->HalfSamples);
+    SET_BIT(hi2s->Channel->CCR, DMA_CCR_EN);
+    SET_BIT(spi->CR2, SPI_CR2_TXDMAEN);
+  }
+  else
+  {
+    /* Clear a stale overrun */
+    (void)spi->DR;
+    (void)spi->SR;
+    SET_BIT(hi2s->Channel->CCR, DMA_CCR_EN);
+    SET_BIT(spi->CR2, SPI_CR2_RXDMAEN);
+  }
+  SET_BIT(spi->I2SCFGR, SPI_I2SCFGR_I2SE);
+}
+
+/**
+  * @brief  Stop streaming.
+  * @note   The frame in progress is cut short.
+  * @param  hi2s stream handle
+  * @retval None
+  */
+void I2SSTREAM_Stop(I2SSTREAM_HandleTypeDef *hi2s)
+{
+  CLEAR_BIT(hi2s->Instance->I2SCFGR, SPI_I2SCFGR_I2SE);
+  CLEAR_BIT(hi2s->Instance->CR2, SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+  CLEAR_BIT(hi2s->Channel->CCR, DMA_CCR_EN);
+  DMA_UTIL_ClearFlags(hi2s->Channel, DMA_UTIL_FLAG_ALL);
+  hi2s->Channel->CNDTR = 2UL * hi2s->HalfSamples;
+}
+
+/**
+  * @brief  Handle the SPI/I2S error interrupt.
+  * @param  hi2s stream handle
+  * @retval None
+  */
+void I2SSTREAM_I2S_IRQHandler(I2SSTREAM_HandleTypeDef *hi2s)
+{
+  SPI_TypeDef *spi = hi2s->Instance;
+  uint32_t sr = spi->SR;
+
+  /* UDR is cleared by the SR read above */
+  if ((sr & SPI_SR_UDR) != 0UL)
+  {
+    hi2s->Stats.Underruns++;
+  }
+  if ((sr & SPI_SR_OVR) != 0UL)
+  {
+    (void)spi->DR;
+    (void)spi->SR;
+    hi2s->Stats.Overruns++;
+  }
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  hi2s stream handle
+  * @retval None
+  */
+void I2SSTREAM_DMA_IRQHandler(I2SSTREAM_HandleTypeDef *hi2s)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hi2s->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_HT | DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hi2s->Channel, flags);
+    I2SSTREAM_FlagsHandler(hi2s, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context stream handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void I2SSTREAM_FlagsHandler(void *Context, uint32_t Flags)
+{
+  I2SSTREAM_HandleTypeDef *hi2s = (I2SSTREAM_HandleTypeDef *)Context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hi2s->Stats.DmaErrors++;
+    return;
+  }
+  if ((Flags & DMA_UTIL_FLAG_HT) != 0UL)
+  {
+    I2SSTREAM_Refill(hi2s, 0UL);
+  }
+  if ((Flags & DMA_UTIL_FLAG_TC) != 0UL)
+  {
+    I2SSTREAM_Refill(hi2s, 1UL);
+  }
+}
+
+/**
+  * @brief  Clear the statistics.
+  * @param  hi2s stream handle
+  * @retval None
+  */
+void I2SSTREAM_ResetStats(I2SSTREAM_HandleTypeDef *hi2s)
+{
+  hi2s->Stats.Halves = 0UL;
+  hi2s->Stats.Late = 0UL;
+  hi2s->Stats.Underruns = 0UL;
+  hi2s->Stats.Overruns = 0UL;
+  hi2s->Stats.DmaErrors = 0UL;
+  hi2s->Stats.LastCycles = 0UL;
+  hi2s->Stats.MaxCycles = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,562 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_lptim_wheel.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx LPTIM driven hierarchical timer wheel.
+  *
+  *   This file provides:
+  *      - LPWHEEL_Init(): LPTIM free running over 16 bits with the compare
+  *                        match interrupt enabled. The LPTIM interrupt line
+  *                        is enabled by the caller.
+  *
+  *      - LPWHEEL_Start() / LPWHEEL_Cancel(): O(1) timer insertion and
+  *                        removal, safe from any context.
+  *
+  *      - LPWHEEL_IRQHandler(): wheel advance to the current tick, expiry
+  *                        callbacks and next compare value.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_lptim_wheel
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_lptim_wheel.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+#if defined(LPTIM1)
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Private_Defines
+  * @{
+  */
+
+#define LPWHEEL_SLOT_MASK      (LPWHEEL_SLOTS - 1UL)
+#define LPWHEEL_COUNTER_MAX    (0xFFFFUL)
+
+/* Longest compare distance: keeps the 16-bit counter extension unambiguous */
+#define LPWHEEL_HORIZON        (0x8000UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Private_Variables
+  * @{
+  */
+
+/* Lowest set bit position, de Bruijn sequence 0x077CB531 (no CLZ/CTZ on M0+) */
+static const uint8_t LPWHEEL_DeBruijn[32] =
+{
+  0U, 1U, 28U, 2U, 29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U, 8U,
+  31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U, 11U, 5U, 10U, 9U
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Return the position of the lowest set bit.
+  * @param  Bits non-zero value
+  * @retval Bit position
+  */
+static uint32_t LPWHEEL_LowestBit(uint32_t Bits)
+{
+  uint32_t lowest = Bits & (0UL - Bits);
+
+  return LPWHEEL_DeBruijn[(uint32_t)(lowest * 0x077CB531UL) >> 27U];
+}
+
+/**
+  * @brief  Read LPTIM_CNT.
+  * @note   The counter runs asynchronously to PCLK: two equal consecutive
+  *         reads are required.
+  * @param  LPTIMx LPTIM instance
+  * @retval Counter value
+  */
+static uint32_t LPWHEEL_Counter(const LPTIM_TypeDef *LPTIMx)
+{
+  uint32_t count;
+
+  do
+  {
+    count = LPTIMx->CNT;
+  } while (count != LPTIMx->CNT);
+
+  return count;
+}
+
+/**
+  * @brief  Link a timer into the slot matching its expiry.
+  * @param  hwheel timer wheel handle
+  * @param  Timer idle timer, Expiry after the wheel time
+  * @retval None
+  */
+static void LPWHEEL_Place(LPWHEEL_HandleTypeDef *hwheel, LPWHEEL_TimerTypeDef *Timer)
+{
+  uint32_t differ = Timer->Expiry ^ hwheel->Current;
+  uint32_t level = 0UL;
+  uint32_t slot;
+  LPWHEEL_TimerTypeDef **head;
+
+  while ((differ >= LPWHEEL_SLOTS) && (level < (LPWHEEL_LEVELS - 1U)))
+  {
+    differ >>= LPWHEEL_SLOT_BITS;
+    level++;
+  }
+  slot = (Timer->Expiry >> (level * LPWHEEL_SLOT_BITS)) & LPWHEEL_SLOT_MASK;
+
+  head = &hwheel->Slot[level][slot];
+  Timer->Next = *head;
+  if (*head != NULL)
+  {
+    (*head)->Link = &Timer->Next;
+  }
+  *head = Timer;
+  Timer->Link = head;
+  Timer->Index = (level * LPWHEEL_SLOTS) + slot;
+  hwheel->Occupied[level] |= (1UL << slot);
+}
+
+/**
+  * @brief  Unlink a pending timer.
+  * @param  hwheel timer wheel handle
+  * @param  Timer pending timer
+  * @retval None
+  */
+static void LPWHEEL_Unlink(LPWHEEL_HandleTypeDef *hwheel, LPWHEEL_TimerTypeDef *Timer)
+{
+  uint32_t level = Timer->Index / LPWHEEL_SLOTS;
+  uint32_t slot = Timer->Index & LPWHEEL_SLOT_MASK;
+
+  *Timer->Link = Timer->Next;
+  if (Timer->Next != NULL)
+  {
+    Timer->Next->Link = Timer->Link;
+  }
+  Timer->Link = NULL;
+
+  if (hwheel->Slot[level][slot] == NULL)
+  {
+    hwheel->Occupied[level] &= ~(1UL << slot);
+  }
+}
+
+/**
+  * @brief  Find the next tick at which the wheel has work.
+  * @note   A level 0 slot is an expiry; a higher level slot is the tick at
+  *         which it is redistributed, at or before its first expiry. Only
+  *         the top level can hold slots behind the wheel time, for expiries
+  *         past the 32-bit wrap.
+  * @param  hwheel timer wheel handle
+  * @param  Next next event tick
+  * @retval 1 when an event exists, 0 when the wheel is empty
+  */
+static uint32_t LPWHEEL_NextEvent(const LPWHEEL_HandleTypeDef *hwheel, uint32_t *Next)
+{
+  uint32_t current = hwheel->Current;
+  uint32_t level;
+  uint32_t shift;
+  uint32_t span;
+  uint32_t slot;
+  uint32_t bits;
+  uint32_t base;
+
+  for (level = 0UL; level < LPWHEEL_LEVELS; level++)
+  {
+    shift = level * LPWHEEL_SLOT_BITS;
+    slot = (current >> shift) & LPWHEEL_SLOT_MASK;
+    bits = hwheel->Occupied[level] & ~((2UL << slot) - 1UL);
+    if ((bits == 0UL) && (level == (LPWHEEL_LEVELS - 1U)))
+    {
+      bits = hwheel->Occupied[level];
+    }
+
+    if (bits != 0UL)
+    {
+      span = shift + LPWHEEL_SLOT_BITS;
+      base = (span >= 32U) ? 0UL : (current & ~((1UL << span) - 1UL));
+      *Next = base | (LPWHEEL_LowestBit(bits) << shift);
+      return 1UL;
+    }
+  }
+
+  return 0UL;
+}
+
+/**
+  * @brief  Move the wheel time to an event tick and redistribute the slots
+  *         it reaches.
+  * @param  hwheel timer wheel handle
+  * @param  Tick event tick returned by LPWHEEL_NextEvent()
+  * @retval None
+  */
+static void LPWHEEL_Cascade(LPWHEEL_HandleTypeDef *hwheel, uint32_t Tick)
+{
+  uint32_t changed = hwheel->Current ^ Tick;
+  uint32_t level;
+  uint32_t shift;
+  uint32_t slot;
+  LPWHEEL_TimerTypeDef *timer;
+  LPWHEEL_TimerTypeDef *next;
+
+  hwheel->Current = Tick;
+
+  for (level = LPWHEEL_LEVELS - 1U; level > 0UL; level--)
+  {
+    shift = level * LPWHEEL_SLOT_BITS;
+    if ((changed >> shift) == 0UL)
+    {
+      continue;
+    }
+
+    slot = (Tick >> shift) & LPWHEEL_SLOT_MASK;
+    timer = hwheel->Slot[level][slot];
+    hwheel->Slot[level][slot] = NULL;
+    hwheel->Occupied[level] &= ~(1UL << slot);
+
+    /* Now differ from the wheel time below this level only */
+    while (timer != NULL)
+    {
+      next = timer->Next;
+      LPWHEEL_Place(hwheel, timer);
+      hwheel->Stats.Cascades++;
+      timer = next;
+    }
+  }
+}
+
+/**
+  * @brief  Run the timers expiring at the wheel time.
+  * @param  hwheel timer wheel handle
+  * @param  Now tick sampled at interrupt entry
+  * @retval None
+  */
+static void LPWHEEL_Expire(LPWHEEL_HandleTypeDef *hwheel, uint32_t Now)
+{
+  LPWHEEL_TimerTypeDef **head = &hwheel->Slot[0][hwheel->Current & LPWHEEL_SLOT_MASK];
+  LPWHEEL_TimerTypeDef *timer;
+  uint32_t late;
+
+  /* Restarts from the callbacks expire after the wheel time: never here */
+  while ((timer = *head) != NULL)
+  {
+    LPWHEEL_Unlink(hwheel, timer);
+
+    late = Now - timer->Expiry;
+    if (late > hwheel->Stats.MaxLateness)
+    {
+      hwheel->Stats.MaxLateness = late;
+    }
+    hwheel->Stats.Expired++;
+    timer->Callback(timer);
+  }
+}
+
+/**
+  * @brief  Program LPTIM_CMP for the next event.
+  * @note   Events beyond LPWHEEL_HORIZON are replaced by an intermediate
+  *         match at the horizon, so that LPTIM_CNT is read at least twice
+  *         per counter period. An early match only costs a spurious
+  *         interrupt.
+  * @param  hwheel timer wheel handle
+  * @param  Now current tick
+  * @retval None
+  */
+static void LPWHEEL_Program(LPWHEEL_HandleTypeDef *hwheel, uint32_t Now)
+{
+  LPTIM_TypeDef *lptim = hwheel->Instance;
+  uint32_t next = Now + LPWHEEL_HORIZON;
+  uint32_t now;
+
+  if (LPWHEEL_NextEvent(hwheel, &next) != 0UL)
+  {
+    if ((int32_t)(next - Now) < (int32_t)LPWHEEL_MIN_DELTA)
+    {
+      next = Now + LPWHEEL_MIN_DELTA;
+    }
+    if ((next - Now) > LPWHEEL_HORIZON)
+    {
+      next = Now + LPWHEEL_HORIZON;
+    }
+  }
+
+  /* One write in flight at a time: CMPOK acknowledges the previous one */
+  while ((lptim->ISR & LPTIM_ISR_CMPOK) == 0UL)
+  {
+  }
+
+  /* The wait may have brought the counter to the match, or past it */
+  now = LPWHEEL_Now(hwheel);
+  if ((int32_t)(next - now) < (int32_t)LPWHEEL_MIN_DELTA)
+  {
+    next = now + LPWHEEL_MIN_DELTA;
+  }
+  hwheel->Target = next;
+  lptim->ICR = LPTIM_ICR_CMPOKCF;
+  lptim->CMP = next & LPWHEEL_COUNTER_MAX;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPTIM_Wheel_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the wheel and start the LPTIM.
+  * @note   The LPTIM kernel clock must be running; select LSE or LSI to keep
+  *         the wheel running in Stop mode.
+  * @param  hwheel timer wheel handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus LPWHEEL_Init(LPWHEEL_HandleTypeDef *hwheel)
+{
+  LPTIM_TypeDef *lptim;
+  uint32_t level;
+  uint32_t slot;
+
+  if ((hwheel == NULL) || (hwheel->Instance == NULL) || ((hwheel->Prescaler & ~LPTIM_CFGR_PRESC) != 0UL))
+  {
+    return ERROR;
+  }
+
+  lptim = hwheel->Instance;
+  if (lptim == LPTIM1)
+  {
+    SET_BIT(RCC->APBENR1, RCC_APBENR1_LPTIM1EN);
+  }
+#if defined(LPTIM2)
+  else if (lptim == LPTIM2)
+  {
+    SET_BIT(RCC->APBENR1, RCC_APBENR1_LPTIM2EN);
+  }
+#endif /* LPTIM2 */
+  else
+  {
+    return ERROR;
+  }
+  (void)READ_BIT(RCC->APBENR1, RCC_APBENR1_LPTIM1EN);
+
+  for (level = 0UL; level < LPWHEEL_LEVELS; level++)
+  {
+    hwheel->Occupied[level] = 0UL;
+    for (slot = 0UL; slot < LPWHEEL_SLOTS; slot++)
+    {
+      hwheel->Slot[level][slot] = NULL;
+    }
+  }
+  hwheel->Busy = 0UL;
+  LPWHEEL_ResetStats(hwheel);
+
+  /* CFGR and IER are written while disabled, ARR and CMP while enabled */
+  lptim->CR = 0UL;
+  lptim->CFGR = hwheel->Prescaler;
+  lptim->IER = LPTIM_IER_CMPMIE;
+  lptim->CR = LPTIM_CR_ENABLE;
+  lptim->ICR = LPTIM_ICR_ARROKCF | LPTIM_ICR_CMPOKCF;
+  lptim->ARR = LPWHEEL_COUNTER_MAX;
+  while ((lptim->ISR & LPTIM_ISR_ARROK) == 0UL)
+  {
+  }
+  lptim->CMP = LPWHEEL_HORIZON;
+  while ((lptim->ISR & LPTIM_ISR_CMPOK) == 0UL)
+  {
+  }
+  SET_BIT(lptim->CR, LPTIM_CR_CNTSTRT);
+
+  /* Ticks start at the counter value, so that they match CMP */
+  hwheel->LastCount = LPWHEEL_Counter(lptim);
+  hwheel->Time = hwheel->LastCount;
+  hwheel->Current = hwheel->Time;
+  hwheel->Target = LPWHEEL_HORIZON;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start a timer, or restart it when pending.
+  * @note   Callback must be set. The compare value is only rewritten when
+  *         the new expiry comes first.
+  * @param  hwheel timer wheel handle
+  * @param  Timer timer
+  * @param  Delay ticks from now, 1 to LPWHEEL_MAX_DELAY
+  * @retval SUCCESS or ERROR on an invalid parameter
+  */
+ErrorStatus LPWHEEL_Start(LPWHEEL_HandleTypeDef *hwheel, LPWHEEL_TimerTypeDef *Timer, uint32_t Delay)
+{
+  uint32_t primask;
+  uint32_t now;
+
+  if ((Timer == NULL) || (Timer->Callback == NULL) || (Delay == 0UL) || (Delay > LPWHEEL_MAX_DELAY))
+  {
+    return ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (Timer->Link != NULL)
+  {
+    LPWHEEL_Unlink(hwheel, Timer);
+  }
+  now = LPWHEEL_Now(hwheel);
+  Timer->Expiry = now + Delay;
+  LPWHEEL_Place(hwheel, Timer);
+  hwheel->Stats.Started++;
+
+  /* Target is the programmed match, an event or the horizon: a later
+     expiry is picked up there. Within the interrupt handler the compare
+     value is set on exit */
+  if ((hwheel->Busy == 0UL) && ((int32_t)(Timer->Expiry - hwheel->Target) < 0))
+  {
+    LPWHEEL_Program(hwheel, now);
+  }
+
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Cancel a timer; no effect when it is idle.
+  * @note   The compare value is left as is: a match with nothing to expire
+  *         only costs a spurious interrupt.
+  * @param  hwheel timer wheel handle
+  * @param  Timer timer
+  * @retval None
+  */
+void LPWHEEL_Cancel(LPWHEEL_HandleTypeDef *hwheel, LPWHEEL_TimerTypeDef *Timer)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (Timer->Link != NULL)
+  {
+    LPWHEEL_Unlink(hwheel, Timer);
+    hwheel->Stats.Cancelled++;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Tell whether a timer is pending.
+  * @param  Timer timer
+  * @retval 1 when pending, 0 when idle
+  */
+uint32_t LPWHEEL_IsPending(const LPWHEEL_TimerTypeDef *Timer)
+{
+  return (Timer->Link != NULL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Return the 32-bit tick count.
+  * @note   Extends LPTIM_CNT from the previous read, at most one counter
+  *         half period old thanks to the compare interrupt.
+  * @param  hwheel timer wheel handle
+  * @retval Ticks, counted from LPTIM_CNT at LPWHEEL_Init()
+  */
+uint32_t LPWHEEL_Now(LPWHEEL_HandleTypeDef *hwheel)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t count;
+  uint32_t time;
+
+  __disable_irq();
+  count = LPWHEEL_Counter(hwheel->Instance);
+  hwheel->Time += (count - hwheel->LastCount) & LPWHEEL_COUNTER_MAX;
+  hwheel->LastCount = count;
+  time = hwheel->Time;
+  __set_PRIMASK(primask);
+
+  return time;
+}
+
+/**
+  * @brief  Handle the LPTIM interrupt.
+  * @param  hwheel timer wheel handle
+  * @retval None
+  */
+void LPWHEEL_IRQHandler(LPWHEEL_HandleTypeDef *hwheel)
+{
+  LPTIM_TypeDef *lptim = hwheel->Instance;
+  uint32_t now;
+  uint32_t next;
+
+  lptim->ICR = LPTIM_ICR_CMPMCF;
+  hwheel->Stats.Interrupts++;
+
+  now = LPWHEEL_Now(hwheel);
+  hwheel->Busy = 1UL;
+  while ((LPWHEEL_NextEvent(hwheel, &next) != 0UL) && ((int32_t)(next - now) <= 0))
+  {
+    LPWHEEL_Cascade(hwheel, next);
+    LPWHEEL_Expire(hwheel, now);
+  }
+  /* No event up to now: no slot is reached on the way */
+  hwheel->Current = now;
+  hwheel->Busy = 0UL;
+
+  LPWHEEL_Program(hwheel, LPWHEEL_Now(hwheel));
+}
+
+/**
+  * @brief  Reset the statistics.
+  * @param  hwheel timer wheel handle
+  * @retval None
+  */
+void LPWHEEL_ResetStats(LPWHEEL_HandleTypeDef *hwheel)
+{
+  hwheel->Stats.Started = 0UL;
+  hwheel->Stats.Cancelled = 0UL;
+  hwheel->Stats.Expired = 0UL;
+  hwheel->Stats.Cascades = 0UL;
+  hwheel->Stats.Interrupts = 0UL;
+  hwheel->Stats.MaxLateness = 0UL;
+}
+
+/**
+  * @}
+  */
+
+#endif /* LPTIM1 */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
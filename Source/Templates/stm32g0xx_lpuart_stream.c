@@ -0,0 +1,276 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_lpuart_stream.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx LPUART reception across Stop mode.
+  *
+  *   This file provides:
+  *      - LPSTREAM_Init(): checks the LPUART kernel clock can run in Stop and
+  *                         enables the LPUART in Stop mode with its receive
+  *                         FIFO and wake-up threshold, on top of
+  *                         USARTRX_Init().
+  *
+  *      - LPSTREAM_Sleep(): idle loop entry. Cycles through Stop until a
+  *                          frame or watermark span is delivered.
+  *
+  *      - LPSTREAM_USART_IRQHandler(): LPUART vector, runs the receiver
+  *                                     handler. The
+  *                                     DMA vector calls
+  *                                     USARTRX_DMA_IRQHandler(&hstream->Rx).
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_lpuart_stream
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_LPUART_Stream_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_lpuart_stream.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+#if defined(LPUART1)
+
+/** @addtogroup STM32G0xx_LPUART_Stream_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Tell whether an LPUART kernel clock keeps running in Stop.
+  * @note   Only HSI16 and LSE (LPUARTxSEL = 1x) are available in Stop mode.
+  * @param  Instance LPUART instance
+  * @retval 1 when the instance can receive in Stop, 0 otherwise
+  */
+static uint32_t LPSTREAM_IsStopCapable(const USART_TypeDef *Instance)
+{
+  if (Instance == LPUART1)
+  {
+    return ((RCC->CCIPR & RCC_CCIPR_LPUART1SEL_1) != 0UL) ? 1UL : 0UL;
+  }
+#if defined(LPUART2)
+  if (Instance == LPUART2)
+  {
+    return ((RCC->CCIPR & RCC_CCIPR_LPUART2SEL_1) != 0UL) ? 1UL : 0UL;
+  }
+#endif /* LPUART2 */
+  return 0UL;
+}
+
+/**
+  * @brief  Count frame and watermark spans, then forward them.
+  * @param  hrx receiver handle, first member of the stream handle
+  * @param  Data span start
+  * @param  Length span length
+  * @param  Event USARTRX_EVENT_xx
+  * @retval None
+  */
+static void LPSTREAM_SpanRelay(USARTRX_HandleTypeDef *hrx, const uint8_t *Data, uint32_t Length, uint32_t Event)
+{
+  LPSTREAM_HandleTypeDef *hstream = (LPSTREAM_HandleTypeDef *)hrx;
+
+  if (Event != USARTRX_EVENT_POLL)
+  {
+    hstream->EventCount++;
+    hstream->Stats.Events++;
+  }
+  hstream->SpanCallback(hrx, Data, Length, Event);
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_LPUART_Stream_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the stream.
+  * @param  hstream stream handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus LPSTREAM_Init(LPSTREAM_HandleTypeDef *hstream)
+{
+  USART_TypeDef *lpuart;
+
+  if ((hstream == NULL) || (hstream->SpanCallback == NULL) ||
+      (LPSTREAM_IsStopCapable(hstream->Rx.Instance) == 0UL) ||
+      ((hstream->StopMode != LPSTREAM_STOP0) && (hstream->StopMode != LPSTREAM_STOP1)) ||
+      ((hstream->Wakeup & ~USART_CR3_RXFTCFG) != 0UL) || (hstream->Wakeup > LPSTREAM_WAKEUP_6_BYTES) ||
+      ((hstream->TimeBase != NULL) && (hstream->TimeBaseMask == 0UL)))
+  {
+    return ERROR;
+  }
+
+  /* PWR_CR1 LPMS writes are ignored without the PWR clock */
+  SET_BIT(RCC->APBENR1, RCC_APBENR1_PWREN);
+  (void)READ_BIT(RCC->APBENR1, RCC_APBENR1_PWREN);
+
+  hstream->Rx.Framing = USARTRX_FRAMING_IDLE;
+  hstream->Rx.SpanCallback = LPSTREAM_SpanRelay;
+  if (USARTRX_Init(&hstream->Rx) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* USARTRX_Init() leaves UE cleared: FIFOEN and UESM may be written.
+     RXFTIE is only set around Stop, the DMA empties the FIFO otherwise */
+  lpuart = hstream->Rx.Instance;
+  SET_BIT(lpuart->CR1, USART_CR1_FIFOEN | USART_CR1_UESM);
+  MODIFY_REG(lpuart->CR3, USART_CR3_RXFTCFG | USART_CR3_RXFTIE | USART_CR3_WUFIE, hstream->Wakeup);
+
+  hstream->EventCount = 0UL;
+  hstream->EventSeen = 0UL;
+  hstream->Stats.StopEntries = 0UL;
+  hstream->Stats.DataWakeups = 0UL;
+  hstream->Stats.Events = 0UL;
+  hstream->Stats.LastRestore = 0UL;
+  hstream->Stats.MaxRestore = 0UL;
+  hstream->Stats.BytesLost = 0UL;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start receiving.
+  * @param  hstream stream handle
+  * @retval None
+  */
+void LPSTREAM_Start(LPSTREAM_HandleTypeDef *hstream)
+{
+  USARTRX_Start(&hstream->Rx);
+}
+
+/**
+  * @brief  Stop receiving; pending data are delivered first.
+  * @param  hstream stream handle
+  * @retval None
+  */
+void LPSTREAM_Stop(LPSTREAM_HandleTypeDef *hstream)
+{
+  USARTRX_Stop(&hstream->Rx);
+}
+
+/**
+  * @brief  Wait in Stop mode for the next frame or watermark.
+  * @note   To be called from the idle loop with interrupts enabled. Returns at once
+  *         when spans were delivered since the previous call. The device is
+  *         not put in Stop while the receive FIFO still holds data for the
+  *         DMA. In Stop the DMA request is held off, so the FIFO alone takes
+  *         the bytes arriving until the clocks are restored.
+  * @param  hstream stream handle
+  * @retval Number of frame and watermark spans delivered since the last call
+  */
+uint32_t LPSTREAM_Sleep(LPSTREAM_HandleTypeDef *hstream)
+{
+  USART_TypeDef *lpuart = hstream->Rx.Instance;
+  uint32_t primask;
+  uint32_t isr;
+  uint32_t start;
+  uint32_t restore;
+  uint32_t events;
+
+  while (hstream->EventCount == hstream->EventSeen)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if ((hstream->EventCount == hstream->EventSeen) && ((lpuart->ISR & USART_ISR_RXNE_RXFNE) == 0UL))
+    {
+      /* The FIFO fills up to the threshold without DMA requests */
+      CLEAR_BIT(lpuart->CR3, USART_CR3_DMAR);
+      SET_BIT(lpuart->CR3, USART_CR3_RXFTIE);
+      MODIFY_REG(PWR->CR1, PWR_CR1_LPMS, hstream->StopMode);
+      SET_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+      hstream->Stats.StopEntries++;
+      __DSB();
+      __WFI();
+      start = (hstream->TimeBase != NULL) ? *hstream->TimeBase : 0UL;
+      isr = lpuart->ISR;
+      CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+      CLEAR_BIT(lpuart->CR3, USART_CR3_RXFTIE);
+
+      /* Interrupts stay masked until the application clocks are back, the
+         FIFO takes the bytes arriving meanwhile */
+      if (hstream->ClockRestore != NULL)
+      {
+        hstream->ClockRestore(hstream);
+      }
+      if (hstream->TimeBase != NULL)
+      {
+        restore = (*hstream->TimeBase - start) & hstream->TimeBaseMask;
+        hstream->Stats.LastRestore = restore;
+        if (restore > hstream->Stats.MaxRestore)
+        {
+          hstream->Stats.MaxRestore = restore;
+        }
+      }
+
+      if ((isr & USART_ISR_RXFT) != 0UL)
+      {
+        hstream->Stats.DataWakeups++;
+      }
+      if ((lpuart->ISR & USART_ISR_ORE) != 0UL)
+      {
+        hstream->Stats.BytesLost++;
+      }
+      SET_BIT(lpuart->CR3, USART_CR3_DMAR);
+    }
+
+    /* Pending DMA and LPUART interrupts run here */
+    __set_PRIMASK(primask);
+  }
+
+  events = hstream->EventCount - hstream->EventSeen;
+  hstream->EventSeen += events;
+
+  return events;
+}
+
+/**
+  * @brief  Handle the LPUART interrupt.
+  * @param  hstream stream handle
+  * @retval None
+  */
+void LPSTREAM_USART_IRQHandler(LPSTREAM_HandleTypeDef *hstream)
+{
+  USARTRX_USART_IRQHandler(&hstream->Rx);
+}
+
+/**
+  * @}
+  */
+
+#endif /* LPUART1 */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
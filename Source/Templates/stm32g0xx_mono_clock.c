@@ -0,0 +1,243 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_mono_clock.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx 64-bit monotonic timer clock.
+  *
+  *   This file provides:
+  *      - MONOCLK_Init(): TIM2, or the TIM3 -> TIM1 chain, free running at
+  *                        the timer kernel clock with the update interrupt
+  *                        enabled. MONOCLK_IRQn is enabled by the caller.
+  *
+  *      - MONOCLK_Read() / MONOCLK_Read32(): 64-bit and low 32-bit counter
+  *                        values, lock free.
+  *
+  *      - MONOCLK_IRQHandler(): overflow count.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_mono_clock
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_Mono_Clock_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_mono_clock.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Mono_Clock_Private_Defines
+  * @{
+  */
+
+/* A pending UIF belongs to the current counter value while it is this low */
+#define MONOCLK_WRAP_WINDOW    (0x80000000UL)
+
+#if !defined(TIM2)
+/* TIM1 internal trigger ITR2 is TIM3 TRGO; external clock mode 1 */
+#define MONOCLK_CHAIN_SMCR     (TIM_SMCR_TS_1 | TIM_SMCR_SMS_2 | TIM_SMCR_SMS_1 | TIM_SMCR_SMS_0)
+
+/* TIM1 counts the TIM3 update a few kernel clocks after the TIM3 wrap: low
+   halves below this value are read again once the carry has propagated */
+#define MONOCLK_CHAIN_GUARD    (8UL)
+#endif /* !TIM2 */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Mono_Clock_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Start a timer free running over its full range.
+  * @note   URS keeps UG from raising UIF; only overflows interrupt.
+  * @param  TIMx timer
+  * @param  Max counter range, 0xFFFF or 0xFFFFFFFF
+  * @retval None
+  */
+static void MONOCLK_SetupTimer(TIM_TypeDef *TIMx, uint32_t Max)
+{
+  TIMx->CR1 = TIM_CR1_URS;
+  TIMx->PSC = 0UL;
+  TIMx->ARR = Max;
+  TIMx->CNT = 0UL;
+  TIMx->EGR = TIM_EGR_UG;
+  TIMx->SR = 0UL;
+}
+
+/**
+  * @brief  Read the 32-bit counter value.
+  * @param  hclk clock handle
+  * @retval Counter value
+  */
+static uint32_t MONOCLK_Counter(const MONOCLK_HandleTypeDef *hclk)
+{
+#if defined(TIM2)
+  return hclk->High->CNT;
+#else
+  uint32_t high;
+  uint32_t low;
+
+  do
+  {
+    high = hclk->High->CNT;
+    low = hclk->Low->CNT;
+  } while ((high != hclk->High->CNT) || (low < MONOCLK_CHAIN_GUARD));
+
+  return (high << 16U) | low;
+#endif /* TIM2 */
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Mono_Clock_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Start the clock from 0.
+  * @param  hclk clock handle
+  * @retval None
+  */
+void MONOCLK_Init(MONOCLK_HandleTypeDef *hclk)
+{
+  hclk->Overflows = 0UL;
+
+#if defined(TIM2)
+  SET_BIT(RCC->APBENR1, RCC_APBENR1_TIM2EN);
+  (void)READ_BIT(RCC->APBENR1, RCC_APBENR1_TIM2EN);
+  hclk->High = TIM2;
+  hclk->Low = NULL;
+
+  MONOCLK_SetupTimer(TIM2, 0xFFFFFFFFUL);
+  TIM2->DIER = TIM_DIER_UIE;
+  SET_BIT(TIM2->CR1, TIM_CR1_CEN);
+#else
+  SET_BIT(RCC->APBENR1, RCC_APBENR1_TIM3EN);
+  SET_BIT(RCC->APBENR2, RCC_APBENR2_TIM1EN);
+  (void)READ_BIT(RCC->APBENR2, RCC_APBENR2_TIM1EN);
+  hclk->High = TIM1;
+  hclk->Low = TIM3;
+
+  /* TIM3: low half, update event as TRGO */
+  MONOCLK_SetupTimer(TIM3, 0xFFFFUL);
+  MODIFY_REG(TIM3->CR2, TIM_CR2_MMS, TIM_CR2_MMS_1);
+
+  /* TIM1: high half, clocked by the TIM3 updates, update on every wrap */
+  TIM1->RCR = 0UL;
+  MONOCLK_SetupTimer(TIM1, 0xFFFFUL);
+  TIM1->SMCR = MONOCLK_CHAIN_SMCR;
+  TIM1->DIER = TIM_DIER_UIE;
+
+  /* Slave first so that no carry is lost */
+  SET_BIT(TIM1->CR1, TIM_CR1_CEN);
+  SET_BIT(TIM3->CR1, TIM_CR1_CEN);
+#endif /* TIM2 */
+}
+
+/**
+  * @brief  Read the 64-bit clock.
+  * @note   Lock free; the caller must not preempt the update interrupt.
+  * @param  hclk clock handle
+  * @retval Kernel clock periods since MONOCLK_Init()
+  */
+uint64_t MONOCLK_Read(const MONOCLK_HandleTypeDef *hclk)
+{
+  uint32_t overflows;
+  uint32_t high;
+  uint32_t counter;
+
+  do
+  {
+    overflows = hclk->Overflows;
+    counter = MONOCLK_Counter(hclk);
+    high = overflows;
+    /* Wrapped, interrupt not served yet */
+    if (((hclk->High->SR & TIM_SR_UIF) != 0UL) && (counter < MONOCLK_WRAP_WINDOW))
+    {
+      high++;
+    }
+  } while (overflows != hclk->Overflows);
+
+  return ((uint64_t)high << 32U) | counter;
+}
+
+/**
+  * @brief  Read the low 32 bits of the clock.
+  * @note   Enough for intervals below 2^32 periods: (end - start) wraps
+  *         correctly.
+  * @param  hclk clock handle
+  * @retval Low 32 bits
+  */
+uint32_t MONOCLK_Read32(const MONOCLK_HandleTypeDef *hclk)
+{
+  return MONOCLK_Counter(hclk);
+}
+
+/**
+  * @brief  Return the counting frequency.
+  * @note   The timer kernel clock is PCLK, doubled when the APB prescaler
+  *         divides. Relies on SystemCoreClock being up to date.
+  * @retval Frequency in Hz
+  */
+uint32_t MONOCLK_GetFrequency(void)
+{
+  uint32_t ppre = APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE) >> RCC_CFGR_PPRE_Pos];
+
+  return (ppre == 0UL) ? SystemCoreClock : ((SystemCoreClock >> ppre) * 2UL);
+}
+
+/**
+  * @brief  Handle the update interrupt (TIM2, or TIM1 in the chain).
+  * @note   On TIM1 the interrupt vector is shared with break, trigger and
+  *         commutation, which are left disabled.
+  * @param  hclk clock handle
+  * @retval None
+  */
+void MONOCLK_IRQHandler(MONOCLK_HandleTypeDef *hclk)
+{
+  if ((hclk->High->SR & TIM_SR_UIF) != 0UL)
+  {
+    hclk->High->SR = ~TIM_SR_UIF;
+    hclk->Overflows++;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,264 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_spi_burst.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx SPI packed burst transfers.
+  *
+  *   This file provides:
+  *      - SPIBURST_Exchange(): polled full-duplex transfer with half-word
+  *                             SPI_DR accesses. SPIBURST_Write() discards
+  *                             the received frames, SPIBURST_Read() sends
+  *                             SPIBURST_DUMMY_BYTE.
+  *
+  *      - SPIBURST_Benchmark(): runs the same transfer byte-wise then packed
+  *                              and reports the SysTick cycles of each, on
+  *                              the target.
+  *
+  *   The SPI must be configured as master with 8-bit frames, SPE is set if
+  *   needed. The chip select is handled by the caller.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_spi_burst
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_SPI_Burst_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_spi_burst.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Burst_Private_Defines
+  * @{
+  */
+
+#define SPIBURST_DS_8BIT       (0x7UL << SPI_CR2_DS_Pos)
+
+#define SPIBURST_DR8(SPIx)     (*(__IO uint8_t *)&(SPIx)->DR)
+#define SPIBURST_DR16(SPIx)    (*(__IO uint16_t *)&(SPIx)->DR)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Burst_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Polled full-duplex transfer.
+  * @param  SPIx SPI instance
+  * @param  TxData frames to send, NULL sends SPIBURST_DUMMY_BYTE
+  * @param  RxData received frames, NULL discards
+  * @param  Length number of frames
+  * @param  Packed 1 for half-word DR accesses, 0 for one access per frame
+  * @retval None
+  */
+static void SPIBURST_Run(SPI_TypeDef *SPIx, const uint8_t *TxData, uint8_t *RxData, uint32_t Length,
+                         uint32_t Packed)
+{
+  uint32_t tx = 0UL;
+  uint32_t rx = 0UL;
+  uint32_t sr;
+  uint32_t data;
+
+  /* RXNE on two frames while at least two remain to be read */
+  if ((Packed != 0UL) && (Length >= 2UL))
+  {
+    CLEAR_BIT(SPIx->CR2, SPI_CR2_FRXTH);
+  }
+  else
+  {
+    SET_BIT(SPIx->CR2, SPI_CR2_FRXTH);
+  }
+
+  while (rx < Length)
+  {
+    sr = SPIx->SR;
+
+    if ((tx < Length) && ((sr & SPI_SR_TXE) != 0UL))
+    {
+      if ((Packed != 0UL) && ((Length - tx) >= 2UL))
+      {
+        if ((tx - rx) <= (SPIBURST_FIFO_BYTES - 2UL))
+        {
+          data = (TxData != NULL) ? ((uint32_t)TxData[tx] | ((uint32_t)TxData[tx + 1UL] << 8U)) : 0xFFFFUL;
+          SPIBURST_DR16(SPIx) = (uint16_t)data;
+          tx += 2UL;
+        }
+      }
+      else if ((tx - rx) < SPIBURST_FIFO_BYTES)
+      {
+        SPIBURST_DR8(SPIx) = (TxData != NULL) ? TxData[tx] : SPIBURST_DUMMY_BYTE;
+        tx++;
+      }
+      else
+      {
+        /* Receive FIFO could overrun, wait for a read */
+      }
+    }
+
+    if ((sr & SPI_SR_RXNE) != 0UL)
+    {
+      if ((Packed != 0UL) && ((Length - rx) >= 2UL))
+      {
+        data = SPIBURST_DR16(SPIx);
+        if (RxData != NULL)
+        {
+          RxData[rx] = (uint8_t)data;
+          RxData[rx + 1UL] = (uint8_t)(data >> 8U);
+        }
+        rx += 2UL;
+        if ((Length - rx) == 1UL)
+        {
+          /* Odd length: the last frame raises RXNE alone */
+          SET_BIT(SPIx->CR2, SPI_CR2_FRXTH);
+        }
+      }
+      else
+      {
+        data = SPIBURST_DR8(SPIx);
+        if (RxData != NULL)
+        {
+          RxData[rx] = (uint8_t)data;
+        }
+        rx++;
+      }
+    }
+  }
+
+  SET_BIT(SPIx->CR2, SPI_CR2_FRXTH);
+}
+
+/**
+  * @brief  Check and complete the SPI configuration.
+  * @param  SPIx SPI instance
+  * @retval SUCCESS, or ERROR when the frames are not 8-bit
+  */
+static ErrorStatus SPIBURST_Prepare(SPI_TypeDef *SPIx)
+{
+  if ((SPIx == NULL) || ((SPIx->CR2 & SPI_CR2_DS) != SPIBURST_DS_8BIT))
+  {
+    return ERROR;
+  }
+  SET_BIT(SPIx->CR1, SPI_CR1_SPE);
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Burst_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Polled full-duplex packed transfer.
+  * @param  SPIx SPI instance
+  * @param  TxData frames to send, NULL sends SPIBURST_DUMMY_BYTE
+  * @param  RxData received frames, NULL discards; may equal TxData
+  * @param  Length number of frames, any parity
+  * @retval SUCCESS, or ERROR when the SPI is not in 8-bit mode
+  */
+ErrorStatus SPIBURST_Exchange(SPI_TypeDef *SPIx, const uint8_t *TxData, uint8_t *RxData, uint32_t Length)
+{
+  if (SPIBURST_Prepare(SPIx) != SUCCESS)
+  {
+    return ERROR;
+  }
+  SPIBURST_Run(SPIx, TxData, RxData, Length, 1UL);
+  return SUCCESS;
+}
+
+/**
+  * @brief  Polled packed write, received frames are discarded.
+  * @param  SPIx SPI instance
+  * @param  Data frames to send
+  * @param  Length number of frames
+  * @retval SUCCESS, or ERROR when the SPI is not in 8-bit mode
+  */
+ErrorStatus SPIBURST_Write(SPI_TypeDef *SPIx, const uint8_t *Data, uint32_t Length)
+{
+  return SPIBURST_Exchange(SPIx, Data, NULL, Length);
+}
+
+/**
+  * @brief  Polled packed read, SPIBURST_DUMMY_BYTE is sent.
+  * @param  SPIx SPI instance
+  * @param  Data received frames
+  * @param  Length number of frames
+  * @retval SUCCESS, or ERROR when the SPI is not in 8-bit mode
+  */
+ErrorStatus SPIBURST_Read(SPI_TypeDef *SPIx, uint8_t *Data, uint32_t Length)
+{
+  return SPIBURST_Exchange(SPIx, NULL, Data, Length);
+}
+
+/**
+  * @brief  Measure the packed transfer gain on the target.
+  * @note   Buffer is sent and overwritten by the received frames, twice.
+  * @param  SPIx SPI instance
+  * @param  Buffer frames to exchange
+  * @param  Length number of frames
+  * @param  Result cycles of each transfer mode
+  * @retval SUCCESS, or ERROR when the SPI is not in 8-bit mode
+  */
+ErrorStatus SPIBURST_Benchmark(SPI_TypeDef *SPIx, uint8_t *Buffer, uint32_t Length,
+                               SPIBURST_BenchmarkTypeDef *Result)
+{
+  uint32_t start;
+
+  if ((Result == NULL) || (SPIBURST_Prepare(SPIx) != SUCCESS))
+  {
+    return ERROR;
+  }
+
+  Result->Length = Length;
+
+  start = DMA_UTIL_CycleStamp();
+  SPIBURST_Run(SPIx, Buffer, Buffer, Length, 0UL);
+  Result->BytewiseCycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+
+  start = DMA_UTIL_CycleStamp();
+  SPIBURST_Run(SPIx, Buffer, Buffer, Length, 1UL);
+  Result->PackedCycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,382 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_spi_queue.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx SPI DMA transaction queue.
+  *
+  *   This file provides:
+  *      - SPIQ_Init(): routes and configures the transmit and receive DMA
+  *                     channels and enables the SPI DMA requests.
+  *
+  *      - SPIQ_Submit(): appends a transaction, starting it when the bus is
+  *                       idle.
+  *
+  *      - SPIQ_IRQHandler(): DMA vector(s) of the two channels. On receive
+  *                           complete: CS release, next transaction launch,
+  *                           then the callback.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_spi_queue
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_SPI_Queue_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_spi_queue.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Queue_Private_Defines
+  * @{
+  */
+
+/* Byte transfers; MINC and EN are added per transaction */
+#define SPIQ_RX_CCR            (DMA_CCR_TCIE | DMA_CCR_TEIE)
+#define SPIQ_TX_CCR            (DMA_CCR_DIR | DMA_CCR_TEIE)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Queue_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Assert the chip select and start both DMA channels.
+  * @note   The receive channel is enabled first so that no frame is missed.
+  * @param  hspiq queue handle
+  * @param  Transaction transaction to start
+  * @retval None
+  */
+static void SPIQ_Launch(SPIQ_HandleTypeDef *hspiq, const SPIQ_TransactionTypeDef *Transaction)
+{
+  DMA_Channel_TypeDef *rx = hspiq->RxChannel;
+  DMA_Channel_TypeDef *tx = hspiq->TxChannel;
+  uint32_t rxccr = SPIQ_RX_CCR | hspiq->Priority;
+  uint32_t txccr = SPIQ_TX_CCR | hspiq->Priority;
+
+  rx->CNDTR = Transaction->Length;
+  tx->CNDTR = Transaction->Length;
+  if (Transaction->RxData != NULL)
+  {
+    rx->CMAR = (uint32_t)Transaction->RxData;
+    rxccr |= DMA_CCR_MINC;
+  }
+  else
+  {
+    rx->CMAR = (uint32_t)&hspiq->DummyRx;
+  }
+  if (Transaction->TxData != NULL)
+  {
+    tx->CMAR = (uint32_t)Transaction->TxData;
+    txccr |= DMA_CCR_MINC;
+  }
+  else
+  {
+    tx->CMAR = (uint32_t)&hspiq->DummyTx;
+  }
+
+  if (Transaction->CsPort != NULL)
+  {
+    Transaction->CsPort->BSRR = Transaction->CsPin << 16U;
+  }
+  hspiq->StartStamp = DMA_UTIL_CycleStamp();
+  rx->CCR = rxccr | DMA_CCR_EN;
+  tx->CCR = txccr | DMA_CCR_EN;
+}
+
+/**
+  * @brief  Retire the running transaction and launch the next one.
+  * @param  hspiq queue handle
+  * @param  Status transaction outcome
+  * @retval None
+  */
+static void SPIQ_Complete(SPIQ_HandleTypeDef *hspiq, ErrorStatus Status)
+{
+  SPIQ_TransactionTypeDef *done = hspiq->Head;
+  SPIQ_TransactionTypeDef *next;
+  uint32_t end = DMA_UTIL_CycleStamp();
+  uint32_t gap;
+
+  hspiq->RxChannel->CCR = 0UL;
+  hspiq->TxChannel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hspiq->RxChannel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_ClearFlags(hspiq->TxChannel, DMA_UTIL_FLAG_ALL);
+  if (done == NULL)
+  {
+    return;
+  }
+
+  if ((done->CsPort != NULL) && (((done->Flags & SPIQ_FLAG_KEEP_CS) == 0U) || (Status != SUCCESS)))
+  {
+    done->CsPort->BSRR = done->CsPin;
+  }
+  if (Status != SUCCESS)
+  {
+    /* Do not leak frames of the failed transaction into the next one */
+    while ((hspiq->Instance->SR & (SPI_SR_FTLVL | SPI_SR_BSY)) != 0UL)
+    {
+    }
+    while ((hspiq->Instance->SR & SPI_SR_FRLVL) != 0UL)
+    {
+      (void)*(__IO uint8_t *)&hspiq->Instance->DR;
+    }
+  }
+  hspiq->Stats.BusyCycles += DMA_UTIL_CycleElapsed(hspiq->StartStamp, end);
+
+  /* Keep the bus busy: next transaction before any callback */
+  next = done->Next;
+  hspiq->Head = next;
+  if (next != NULL)
+  {
+    SPIQ_Launch(hspiq, next);
+    gap = DMA_UTIL_CycleElapsed(end, hspiq->StartStamp);
+    hspiq->Stats.GapCycles += gap;
+    hspiq->Stats.LastGapCycles = gap;
+    if (gap > hspiq->Stats.MaxGapCycles)
+    {
+      hspiq->Stats.MaxGapCycles = gap;
+    }
+  }
+  else
+  {
+    hspiq->Tail = NULL;
+  }
+
+  if (Status == SUCCESS)
+  {
+    hspiq->Stats.Transactions++;
+    hspiq->Stats.Bytes += done->Length;
+  }
+  else
+  {
+    hspiq->Stats.Errors++;
+  }
+  if (done->Callback != NULL)
+  {
+    done->Callback(done, Status);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_SPI_Queue_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the queue.
+  * @param  hspiq queue handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus SPIQ_Init(SPIQ_HandleTypeDef *hspiq)
+{
+  SPI_TypeDef *spi;
+
+  if ((hspiq == NULL) || (hspiq->Instance == NULL) ||
+      (hspiq->TxChannel == NULL) || (hspiq->RxChannel == NULL) || (hspiq->TxChannel == hspiq->RxChannel) ||
+      ((hspiq->Priority & ~DMA_CCR_PL) != 0UL))
+  {
+    return ERROR;
+  }
+
+  spi = hspiq->Instance;
+
+  DMA_UTIL_EnableClock(hspiq->TxChannel);
+  DMA_UTIL_EnableClock(hspiq->RxChannel);
+  hspiq->TxChannel->CCR = 0UL;
+  hspiq->RxChannel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(hspiq->TxChannel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_ClearFlags(hspiq->RxChannel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(hspiq->TxChannel)->CCR =
+    (hspiq->TxRequest << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  DMA_UTIL_GetMuxChannel(hspiq->RxChannel)->CCR =
+    (hspiq->RxRequest << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  hspiq->TxChannel->CPAR = (uint32_t)&spi->DR;
+  hspiq->RxChannel->CPAR = (uint32_t)&spi->DR;
+
+  hspiq->Head = NULL;
+  hspiq->Tail = NULL;
+  hspiq->DummyTx = SPIQ_DUMMY_BYTE;
+  SPIQ_ResetStats(hspiq);
+
+  /* 8-bit reception event, receive DMA request enabled before transmit */
+  SET_BIT(spi->CR2, SPI_CR2_FRXTH);
+  SET_BIT(spi->CR2, SPI_CR2_RXDMAEN);
+  SET_BIT(spi->CR2, SPI_CR2_TXDMAEN);
+  SET_BIT(spi->CR1, SPI_CR1_SPE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Queue a transaction.
+  * @param  hspiq queue handle
+  * @param  Transaction transaction, owned by the queue until its callback
+  * @retval SUCCESS or ERROR on an invalid transaction
+  */
+ErrorStatus SPIQ_Submit(SPIQ_HandleTypeDef *hspiq, SPIQ_TransactionTypeDef *Transaction)
+{
+  uint32_t primask;
+
+  if ((Transaction == NULL) || (Transaction->Length == 0U))
+  {
+    return ERROR;
+  }
+  Transaction->Next = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (hspiq->Head == NULL)
+  {
+    hspiq->Head = Transaction;
+    hspiq->Tail = Transaction;
+    SPIQ_Launch(hspiq, Transaction);
+  }
+  else
+  {
+    hspiq->Tail->Next = Transaction;
+    hspiq->Tail = Transaction;
+  }
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Tell whether the queue is empty.
+  * @param  hspiq queue handle
+  * @retval 1 when idle, 0 otherwise
+  */
+uint32_t SPIQ_IsIdle(const SPIQ_HandleTypeDef *hspiq)
+{
+  return (hspiq->Head == NULL) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Handle the DMA interrupt(s) of both channels.
+  * @param  hspiq queue handle
+  * @retval None
+  */
+void SPIQ_IRQHandler(SPIQ_HandleTypeDef *hspiq)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hspiq->TxChannel);
+
+  if ((flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hspiq->TxChannel, flags);
+    SPIQ_TxFlagsHandler(hspiq, flags);
+  }
+
+  flags = DMA_UTIL_GetFlags(hspiq->RxChannel);
+  if ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hspiq->RxChannel, flags);
+    SPIQ_RxFlagsHandler(hspiq, flags);
+  }
+}
+
+/**
+  * @brief  Process receive channel flags already read and cleared by the
+  *         caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef. Flags read before the
+  *         running transaction was launched, e.g. both channels in error in
+  *         one snapshot, are ignored: an error disables its channel and a
+  *         completion leaves CNDTR at 0, which a fresh transaction does not.
+  * @param  Context queue handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void SPIQ_RxFlagsHandler(void *Context, uint32_t Flags)
+{
+  SPIQ_HandleTypeDef *hspiq = (SPIQ_HandleTypeDef *)Context;
+  DMA_Channel_TypeDef *rx = hspiq->RxChannel;
+
+  if (((Flags & DMA_UTIL_FLAG_TE) != 0UL) && ((rx->CCR & DMA_CCR_EN) == 0UL))
+  {
+    SPIQ_Complete(hspiq, ERROR);
+  }
+  else if (((Flags & DMA_UTIL_FLAG_TC) != 0UL) && ((rx->CNDTR & DMA_CNDTR_NDT) == 0UL))
+  {
+    SPIQ_Complete(hspiq, SUCCESS);
+  }
+  else
+  {
+    /* Half transfer, not enabled, or flags of a retired transaction */
+  }
+}
+
+/**
+  * @brief  Process transmit channel flags already read and cleared by the
+  *         caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef. Only errors are enabled
+  *         on the transmit channel; as for the receive channel, an error of
+  *         a retired transaction is ignored.
+  * @param  Context queue handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void SPIQ_TxFlagsHandler(void *Context, uint32_t Flags)
+{
+  SPIQ_HandleTypeDef *hspiq = (SPIQ_HandleTypeDef *)Context;
+
+  if (((Flags & DMA_UTIL_FLAG_TE) != 0UL) && ((hspiq->TxChannel->CCR & DMA_CCR_EN) == 0UL))
+  {
+    SPIQ_Complete(hspiq, ERROR);
+  }
+}
+
+/**
+  * @brief  Reset the statistics.
+  * @param  hspiq queue handle
+  * @retval None
+  */
+void SPIQ_ResetStats(SPIQ_HandleTypeDef *hspiq)
+{
+  hspiq->Stats.Transactions = 0UL;
+  hspiq->Stats.Bytes = 0UL;
+  hspiq->Stats.Errors = 0UL;
+  hspiq->Stats.BusyCycles = 0UL;
+  hspiq->Stats.GapCycles = 0UL;
+  hspiq->Stats.LastGapCycles = 0UL;
+  hspiq->Stats.MaxGapCycles = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
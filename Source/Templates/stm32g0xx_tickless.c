@@ -0,0 +1,430 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tickless.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx tickless idle timekeeping.
+  *
+  *   This file provides:
+  *      - TICKLESS_Init(): SysTick at TickRate and LPTIM free running over
+  *                         16 bits with the compare match interrupt enabled.
+  *
+  *      - TICKLESS_Idle(): idle loop entry. Suppresses SysTick, sleeps up to
+  *                         the expected number of ticks and corrects the
+  *                         tick count on wake-up.
+  *
+  *      - TICKLESS_SysTickHandler() / TICKLESS_IRQHandler(): SysTick_Handler
+  *                         and LPTIM vector bodies.
+  *
+  *      - TICKLESS_GetReport(): wake-up rate and residency per mode.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tickless
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_Tickless_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_tickless.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+#if defined(LPTIM1)
+
+/** @addtogroup STM32G0xx_Tickless_Private_Defines
+  * @{
+  */
+
+#define TICKLESS_COUNTER_MAX   (0xFFFFUL)
+
+/* Longest idle period, in LPTIM ticks: elapsed time stays unambiguous */
+#define TICKLESS_HORIZON       (0x8000UL)
+
+/* Compare write latency, in LPTIM ticks */
+#define TICKLESS_MIN_DELTA     (3UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Tickless_Private_Variables
+  * @{
+  */
+
+/* PWR_CR1 LPMS value per TICKLESS_MODE_xx */
+static const uint32_t TICKLESS_Lpms[TICKLESS_NB_MODES] =
+{
+  0UL,
+  0UL,
+  PWR_CR1_LPMS_0
+};
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Tickless_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Read LPTIM_CNT.
+  * @note   The counter runs asynchronously to PCLK: two equal consecutive
+  *         reads are required.
+  * @param  LPTIMx LPTIM instance
+  * @retval Counter value
+  */
+static uint32_t TICKLESS_Counter(const LPTIM_TypeDef *LPTIMx)
+{
+  uint32_t count;
+
+  do
+  {
+    count = LPTIMx->CNT;
+  } while (count != LPTIMx->CNT);
+
+  return count;
+}
+
+/**
+  * @brief  Select the deepest mode allowed for an idle length.
+  * @param  htickless tickless handle
+  * @param  Ticks expected idle ticks
+  * @retval TICKLESS_MODE_xx
+  */
+static uint32_t TICKLESS_SelectMode(const TICKLESS_HandleTypeDef *htickless, uint32_t Ticks)
+{
+  if ((htickless->Stop1Ticks != 0UL) && (Ticks >= htickless->Stop1Ticks))
+  {
+    return TICKLESS_MODE_STOP1;
+  }
+  if ((htickless->Stop0Ticks != 0UL) && (Ticks >= htickless->Stop0Ticks))
+  {
+    return TICKLESS_MODE_STOP0;
+  }
+  return TICKLESS_MODE_SLEEP;
+}
+
+/**
+  * @brief  Wait for an interrupt in a mode.
+  * @note   Interrupts are masked by the caller; a pending enabled one ends
+  *         the wait without being taken.
+  * @param  htickless tickless handle
+  * @param  Mode TICKLESS_MODE_xx
+  * @retval None
+  */
+static void TICKLESS_Wait(TICKLESS_HandleTypeDef *htickless, uint32_t Mode)
+{
+  if (Mode != TICKLESS_MODE_SLEEP)
+  {
+    MODIFY_REG(PWR->CR1, PWR_CR1_LPMS, TICKLESS_Lpms[Mode]);
+    SET_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+  }
+  __DSB();
+  __WFI();
+  if (Mode != TICKLESS_MODE_SLEEP)
+  {
+    CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+    if (htickless->ClockRestore != NULL)
+    {
+      htickless->ClockRestore(htickless);
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_Tickless_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the tick sources and start SysTick.
+  * @note   Relies on SystemCoreClock being up to date. The SysTick interrupt
+  *         priority is left to the application.
+  * @param  htickless tickless handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus TICKLESS_Init(TICKLESS_HandleTypeDef *htickless)
+{
+  LPTIM_TypeDef *lptim;
+  uint32_t reload;
+
+  if ((htickless == NULL) || (htickless->Instance == NULL) ||
+      ((htickless->Prescaler & ~LPTIM_CFGR_PRESC) != 0UL) ||
+      (htickless->TickRate == 0UL) || (htickless->TickRate > TICKLESS_MAX_TICK_RATE) ||
+      (htickless->LptimFrequency < htickless->TickRate))
+  {
+    return ERROR;
+  }
+
+  reload = SystemCoreClock / htickless->TickRate;
+  htickless->MaxIdleTicks = (uint32_t)(((uint64_t)TICKLESS_HORIZON * htickless->TickRate) / htickless->LptimFrequency);
+  if ((reload == 0UL) || ((reload - 1UL) > SysTick_LOAD_RELOAD_Msk) || (htickless->MaxIdleTicks < 2UL))
+  {
+    return ERROR;
+  }
+
+  lptim = htickless->Instance;
+  if (lptim == LPTIM1)
+  {
+    SET_BIT(RCC->APBENR1, RCC_APBENR1_LPTIM1EN);
+  }
+#if defined(LPTIM2)
+  else if (lptim == LPTIM2)
+  {
+    SET_BIT(RCC->APBENR1, RCC_APBENR1_LPTIM2EN);
+  }
+#endif /* LPTIM2 */
+  else
+  {
+    return ERROR;
+  }
+  /* PWR_CR1 LPMS writes are ignored without the PWR clock */
+  SET_BIT(RCC->APBENR1, RCC_APBENR1_PWREN);
+  (void)READ_BIT(RCC->APBENR1, RCC_APBENR1_PWREN);
+
+  /* CFGR and IER are written while disabled, ARR and CMP while enabled */
+  lptim->CR = 0UL;
+  lptim->CFGR = htickless->Prescaler;
+  lptim->IER = LPTIM_IER_CMPMIE;
+  lptim->CR = LPTIM_CR_ENABLE;
+  lptim->ICR = LPTIM_ICR_ARROKCF | LPTIM_ICR_CMPOKCF;
+  lptim->ARR = TICKLESS_COUNTER_MAX;
+  while ((lptim->ISR & LPTIM_ISR_ARROK) == 0UL)
+  {
+  }
+  lptim->CMP = TICKLESS_COUNTER_MAX;
+  while ((lptim->ISR & LPTIM_ISR_CMPOK) == 0UL)
+  {
+  }
+  SET_BIT(lptim->CR, LPTIM_CR_CNTSTRT);
+
+  htickless->Ticks = 0UL;
+  htickless->Fraction = 0UL;
+  TICKLESS_ResetStats(htickless);
+
+  SysTick->LOAD = reload - 1UL;
+  SysTick->VAL = 0UL;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Return the system tick count.
+  * @param  htickless tickless handle
+  * @retval Ticks since TICKLESS_Init()
+  */
+uint32_t TICKLESS_GetTick(const TICKLESS_HandleTypeDef *htickless)
+{
+  return htickless->Ticks;
+}
+
+/**
+  * @brief  Idle until an interrupt or for a number of ticks.
+  * @note   Called from the idle loop with nothing to run before
+  *         ExpectedTicks. Below 2 ticks the CPU only waits in Sleep with
+  *         SysTick running. The period is clipped to the LPTIM horizon and
+  *         ends early on any enabled interrupt; the interrupt is taken on
+  *         return.
+  * @param  htickless tickless handle
+  * @param  ExpectedTicks ticks until the next timed work, 0xFFFFFFFF when
+  *         none
+  * @retval Ticks added to the tick count by the idle period
+  */
+uint32_t TICKLESS_Idle(TICKLESS_HandleTypeDef *htickless, uint32_t ExpectedTicks)
+{
+  LPTIM_TypeDef *lptim = htickless->Instance;
+  uint32_t primask;
+  uint32_t mode;
+  uint32_t partial;
+  uint32_t start;
+  uint32_t delta;
+  uint32_t begin;
+  uint32_t elapsed;
+  uint32_t added;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (ExpectedTicks > htickless->MaxIdleTicks)
+  {
+    ExpectedTicks = htickless->MaxIdleTicks;
+  }
+
+  if (ExpectedTicks < 2UL)
+  {
+    begin = TICKLESS_Counter(lptim);
+    TICKLESS_Wait(htickless, TICKLESS_MODE_SLEEP);
+    htickless->Stats.Time[TICKLESS_MODE_SLEEP] += (TICKLESS_Counter(lptim) - begin) & TICKLESS_COUNTER_MAX;
+    htickless->Stats.Entries[TICKLESS_MODE_SLEEP]++;
+    htickless->Stats.Wakeups++;
+    __set_PRIMASK(primask);
+    return 0UL;
+  }
+
+  /* Suppress the tick; a tick already due is served first */
+  CLEAR_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+  if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0UL)
+  {
+    SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+    htickless->Stats.Aborted++;
+    __set_PRIMASK(primask);
+    return 0UL;
+  }
+
+  /* Time since the last accounted tick, in LPTIM ticks times TickRate */
+  partial = (uint32_t)(((uint64_t)(SysTick->LOAD - SysTick->VAL) * htickless->LptimFrequency) / SystemCoreClock);
+  start = (partial * htickless->TickRate) + htickless->Fraction;
+
+  /* Wake-up at the expected tick boundary */
+  delta = ((ExpectedTicks * htickless->LptimFrequency) - start + htickless->TickRate - 1UL) / htickless->TickRate;
+  if (delta < TICKLESS_MIN_DELTA)
+  {
+    delta = TICKLESS_MIN_DELTA;
+  }
+
+  begin = TICKLESS_Counter(lptim);
+  while ((lptim->ISR & LPTIM_ISR_CMPOK) == 0UL)
+  {
+  }
+  lptim->ICR = LPTIM_ICR_CMPOKCF | LPTIM_ICR_CMPMCF;
+  lptim->CMP = (begin + delta) & TICKLESS_COUNTER_MAX;
+
+  mode = TICKLESS_SelectMode(htickless, ExpectedTicks);
+  TICKLESS_Wait(htickless, mode);
+
+  elapsed = (TICKLESS_Counter(lptim) - begin) & TICKLESS_COUNTER_MAX;
+  htickless->Stats.Wakeups++;
+  htickless->Stats.Entries[mode]++;
+  htickless->Stats.Time[mode] += elapsed;
+  if ((lptim->ISR & LPTIM_ISR_CMPM) != 0UL)
+  {
+    htickless->Stats.TimerWakeups++;
+  }
+
+  /* Whole ticks to the count, the remainder to the next period */
+  start += elapsed * htickless->TickRate;
+  added = start / htickless->LptimFrequency;
+  htickless->Fraction = start - (added * htickless->LptimFrequency);
+  htickless->Ticks += added;
+
+  SysTick->VAL = 0UL;
+  SET_BIT(SysTick->CTRL, SysTick_CTRL_ENABLE_Msk);
+
+  __set_PRIMASK(primask);
+
+  return added;
+}
+
+/**
+  * @brief  Count a system tick, from SysTick_Handler.
+  * @param  htickless tickless handle
+  * @retval None
+  */
+void TICKLESS_SysTickHandler(TICKLESS_HandleTypeDef *htickless)
+{
+  htickless->Ticks++;
+}
+
+/**
+  * @brief  Handle the LPTIM interrupt: the compare match only wakes the CPU.
+  * @param  htickless tickless handle
+  * @retval None
+  */
+void TICKLESS_IRQHandler(TICKLESS_HandleTypeDef *htickless)
+{
+  htickless->Instance->ICR = LPTIM_ICR_CMPMCF;
+}
+
+/**
+  * @brief  Compute the wake-up rate and the residency per mode.
+  * @param  htickless tickless handle
+  * @param  Report residency report
+  * @retval SUCCESS, or ERROR when no tick elapsed since the reset
+  */
+ErrorStatus TICKLESS_GetReport(const TICKLESS_HandleTypeDef *htickless, TICKLESS_ReportTypeDef *Report)
+{
+  uint64_t span;
+  uint32_t idle = 0UL;
+  uint32_t mode;
+
+  Report->Elapsed = htickless->Ticks - htickless->StatsTick;
+  if (Report->Elapsed == 0UL)
+  {
+    return ERROR;
+  }
+
+  /* Elapsed time in LPTIM ticks */
+  span = ((uint64_t)Report->Elapsed * htickless->LptimFrequency) / htickless->TickRate;
+
+  Report->WakeupRate = (uint32_t)(((uint64_t)htickless->Stats.Wakeups * htickless->TickRate * 1000U) / Report->Elapsed);
+  for (mode = 0UL; mode < TICKLESS_NB_MODES; mode++)
+  {
+    Report->ModePpm[mode] = (uint32_t)(((uint64_t)htickless->Stats.Time[mode] * 1000000U) / span);
+    idle += Report->ModePpm[mode];
+  }
+  Report->ActivePpm = (idle < 1000000UL) ? (1000000UL - idle) : 0UL;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reset the statistics; the report covers the ticks from now on.
+  * @param  htickless tickless handle
+  * @retval None
+  */
+void TICKLESS_ResetStats(TICKLESS_HandleTypeDef *htickless)
+{
+  uint32_t mode;
+
+  htickless->StatsTick = htickless->Ticks;
+  htickless->Stats.Wakeups = 0UL;
+  htickless->Stats.TimerWakeups = 0UL;
+  htickless->Stats.Aborted = 0UL;
+  for (mode = 0UL; mode < TICKLESS_NB_MODES; mode++)
+  {
+    htickless->Stats.Entries[mode] = 0UL;
+    htickless->Stats.Time[mode] = 0UL;
+  }
+}
+
+/**
+  * @}
+  */
+
+#endif /* LPTIM1 */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
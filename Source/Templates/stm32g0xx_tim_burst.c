@@ -0,0 +1,311 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tim_burst.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx timer DMA burst register update.
+  *
+  *   This file provides:
+  *      - TIMBURST_Init() / Start() / Stop(): TIMx_DCR and circular DMA
+  *                                            setup towards TIMx_DMAR.
+  *
+  *      - TIMBURST_FlagsHandler(): half and full events, frame accounting
+  *                                 and refill callback.
+  *
+  *      - TIMBURST_Benchmark(): cycles of one frame written by the CPU, as
+  *                              an update interrupt would, against the
+  *                              refill cost measured while streaming;
+  *                              both as load at a given update rate.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tim_burst
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_TIM_Burst_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_tim_burst.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Burst_Private_Defines
+  * @{
+  */
+
+/* Word transfers, circular over the table */
+#define TIMBURST_CCR           (DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1 | \
+                                DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_TEIE)
+
+/* Last register of each contiguous group */
+#define TIMBURST_REG_LAST_LOW  (TIMBURST_REG_CCR4)
+#define TIMBURST_REG_LAST_HIGH (TIMBURST_REG_CCR6)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Burst_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Check that a frame window stays within one contiguous group.
+  * @param  First first register, TIMBURST_REG_xx
+  * @param  Count registers per frame
+  * @retval 1 when valid, 0 otherwise
+  */
+static uint32_t TIMBURST_IsWindowValid(uint32_t First, uint32_t Count)
+{
+  uint32_t last = First + Count - 1UL;
+
+  if (Count == 0UL)
+  {
+    return 0UL;
+  }
+  if ((First >= TIMBURST_REG_ARR) && (last <= TIMBURST_REG_LAST_LOW))
+  {
+    return 1UL;
+  }
+  if ((First >= TIMBURST_REG_CCR5) && (last <= TIMBURST_REG_LAST_HIGH))
+  {
+    return 1UL;
+  }
+  return 0UL;
+}
+
+/**
+  * @brief  Account one half of the table and run the refill callback.
+  * @param  htim burst engine handle
+  * @param  Half 0 for the first half, 1 for the second
+  * @retval None
+  */
+static void TIMBURST_Refill(TIMBURST_HandleTypeDef *htim, uint32_t Half)
+{
+  uint32_t frames = htim->NbFrames / 2UL;
+  uint32_t start;
+  uint32_t cycles;
+
+  htim->Stats.Frames += frames;
+  if (htim->Callback == NULL)
+  {
+    return;
+  }
+
+  start = DMA_UTIL_CycleStamp();
+  htim->Callback(htim, &htim->Table[Half * frames * htim->Count], frames);
+  cycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+
+  htim->Stats.Refills++;
+  htim->Stats.RefillCycles += cycles;
+  if (cycles > htim->Stats.MaxRefillCycles)
+  {
+    htim->Stats.MaxRefillCycles = cycles;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Burst_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the burst engine, left stopped.
+  * @note   RCR only exists on TIM1, TIM15, TIM16 and TIM17; CCR5 and CCR6
+  *         on TIM1.
+  * @param  htim burst engine handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus TIMBURST_Init(TIMBURST_HandleTypeDef *htim)
+{
+  DMA_Channel_TypeDef *channel;
+
+  if ((htim == NULL) || (htim->Instance == NULL) || (htim->Channel == NULL) || (htim->Table == NULL) ||
+      (TIMBURST_IsWindowValid(htim->First, htim->Count) == 0UL) ||
+      (htim->NbFrames < 2UL) || ((htim->NbFrames & 1UL) != 0UL) ||
+      ((htim->NbFrames * htim->Count) > DMA_CNDTR_NDT) ||
+      ((htim->Priority & ~DMA_CCR_PL) != 0UL))
+  {
+    return ERROR;
+  }
+
+  channel = htim->Channel;
+
+  DMA_UTIL_EnableClock(channel);
+  channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(channel)->CCR = (htim->Request << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  channel->CPAR = (uint32_t)&htim->Instance->DMAR;
+  channel->CMAR = (uint32_t)htim->Table;
+  channel->CNDTR = htim->NbFrames * htim->Count;
+  channel->CCR = TIMBURST_CCR | htim->Priority;
+
+  /* One update request moves Count words, from register First on */
+  CLEAR_BIT(htim->Instance->DIER, TIM_DIER_UDE);
+  htim->Instance->DCR = ((htim->First << TIM_DCR_DBA_Pos) & TIM_DCR_DBA) |
+                        (((htim->Count - 1UL) << TIM_DCR_DBL_Pos) & TIM_DCR_DBL);
+
+  TIMBURST_ResetStats(htim);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start the burst updates from the first frame of the table.
+  * @param  htim burst engine handle
+  * @retval None
+  */
+void TIMBURST_Start(TIMBURST_HandleTypeDef *htim)
+{
+  SET_BIT(htim->Channel->CCR, DMA_CCR_EN);
+  SET_BIT(htim->Instance->DIER, TIM_DIER_UDE);
+}
+
+/**
+  * @brief  Stop the burst updates; the timer keeps running.
+  * @param  htim burst engine handle
+  * @retval None
+  */
+void TIMBURST_Stop(TIMBURST_HandleTypeDef *htim)
+{
+  CLEAR_BIT(htim->Instance->DIER, TIM_DIER_UDE);
+  CLEAR_BIT(htim->Channel->CCR, DMA_CCR_EN);
+  DMA_UTIL_ClearFlags(htim->Channel, DMA_UTIL_FLAG_ALL);
+  htim->Channel->CNDTR = htim->NbFrames * htim->Count;
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  htim burst engine handle
+  * @retval None
+  */
+void TIMBURST_DMA_IRQHandler(TIMBURST_HandleTypeDef *htim)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(htim->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_HT | DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(htim->Channel, flags);
+    TIMBURST_FlagsHandler(htim, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context burst engine handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void TIMBURST_FlagsHandler(void *Context, uint32_t Flags)
+{
+  TIMBURST_HandleTypeDef *htim = (TIMBURST_HandleTypeDef *)Context;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    htim->Stats.DmaErrors++;
+    return;
+  }
+  if ((Flags & DMA_UTIL_FLAG_HT) != 0UL)
+  {
+    TIMBURST_Refill(htim, 0UL);
+  }
+  if ((Flags & DMA_UTIL_FLAG_TC) != 0UL)
+  {
+    TIMBURST_Refill(htim, 1UL);
+  }
+}
+
+/**
+  * @brief  Compare the CPU load of CPU and DMA burst register updates.
+  * @note   The engine must be stopped: the first table frame is written to
+  *         the timer registers by the CPU, together with the UIF clear of
+  *         an update interrupt, and timed. The DMA figure comes from the
+  *         statistics gathered while streaming since the last reset.
+  * @param  htim burst engine handle
+  * @param  UpdateRate update events per second, e.g. 20000
+  * @param  Result cycles and loads
+  * @retval SUCCESS, or ERROR while streaming or on an invalid parameter
+  */
+ErrorStatus TIMBURST_Benchmark(TIMBURST_HandleTypeDef *htim, uint32_t UpdateRate,
+                               TIMBURST_BenchmarkTypeDef *Result)
+{
+  __IO uint32_t *reg;
+  const uint32_t *frame = htim->Table;
+  uint32_t start;
+  uint32_t i;
+
+  if ((Result == NULL) || (UpdateRate == 0UL) || (SystemCoreClock == 0UL) ||
+      ((htim->Channel->CCR & DMA_CCR_EN) != 0UL))
+  {
+    return ERROR;
+  }
+
+  reg = &((__IO uint32_t *)htim->Instance)[htim->First];
+
+  start = DMA_UTIL_CycleStamp();
+  htim->Instance->SR = ~TIM_SR_UIF;
+  for (i = 0UL; i < htim->Count; i++)
+  {
+    reg[i] = frame[i];
+  }
+  Result->CpuFrameCycles = DMA_UTIL_CycleElapsed(start, DMA_UTIL_CycleStamp());
+
+  Result->UpdateRate = UpdateRate;
+  Result->DmaFrameCycles = (htim->Stats.Frames != 0UL) ? (htim->Stats.RefillCycles / htim->Stats.Frames) : 0UL;
+  Result->CpuLoadPpm = (uint32_t)(((uint64_t)Result->CpuFrameCycles * UpdateRate * 1000000U) / SystemCoreClock);
+  Result->DmaLoadPpm = (uint32_t)(((uint64_t)Result->DmaFrameCycles * UpdateRate * 1000000U) / SystemCoreClock);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reset the statistics.
+  * @param  htim burst engine handle
+  * @retval None
+  */
+void TIMBURST_ResetStats(TIMBURST_HandleTypeDef *htim)
+{
+  htim->Stats.Frames = 0UL;
+  htim->Stats.Refills = 0UL;
+  htim->Stats.RefillCycles = 0UL;
+  htim->Stats.MaxRefillCycles = 0UL;
+  htim->Stats.DmaErrors = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
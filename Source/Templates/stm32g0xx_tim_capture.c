@@ -0,0 +1,416 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tim_capture.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx timer input capture DMA engine.
+  *
+  *   This file provides:
+  *      - TIMCAP_Init() / Start() / Stop(): free-running counter, CC1 and
+  *                                          CC2 captures of TI1 and circular
+  *                                          DMA of the capture records.
+  *
+  *      - TIMCAP_FlagsHandler(): per half-ring batch computation of the
+  *                               period, frequency, duty and jitter.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tim_capture
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_TIM_Capture_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_tim_capture.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Capture_Private_Defines
+  * @{
+  */
+
+/* Word transfers from the timer, circular over the ring */
+#define TIMCAP_CCR             (DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1 | \
+                                DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_TEIE)
+
+/* TIMx_DCR DBA value of CCR1 */
+#define TIMCAP_DBA_CCR1        (13UL)
+
+#define TIMCAP_FILTER_MAX      (15UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Capture_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Integer square root.
+  * @param  Value radicand
+  * @retval Floor of the square root
+  */
+static uint32_t TIMCAP_Sqrt(uint64_t Value)
+{
+  uint64_t root = 0U;
+  uint64_t bit = 1ULL << 62U;
+
+  while (bit > Value)
+  {
+    bit >>= 2U;
+  }
+  while (bit != 0U)
+  {
+    if (Value >= (root + bit))
+    {
+      Value -= root + bit;
+      root = (root >> 1U) + bit;
+    }
+    else
+    {
+      root >>= 1U;
+    }
+    bit >>= 2U;
+  }
+
+  return (uint32_t)root;
+}
+
+/**
+  * @brief  Compute the results of one half of the ring.
+  * @note   Deviations are taken from the first period of the batch to keep
+  *         the sums of squares within 64 bits; the RMS saturates to
+  *         0xFFFFFFFF when they still overflow.
+  * @param  hcap capture engine handle
+  * @param  Record first record
+  * @param  Count records
+  * @retval None
+  */
+static void TIMCAP_Process(TIMCAP_HandleTypeDef *hcap, const uint32_t *Record, uint32_t Count)
+{
+  TIMCAP_ResultTypeDef *result = &hcap->Last;
+  uint64_t sum = 0U;
+  uint64_t sumDuty = 0U;
+  uint64_t sumHigh = 0U;
+  uint64_t squares = 0U;
+  int64_t deviations = 0;
+  int64_t mean;
+  int64_t variance;
+  int32_t deviation;
+  uint32_t reference = 0UL;
+  uint32_t shortest = 0xFFFFFFFFUL;
+  uint32_t longest = 0UL;
+  uint32_t periods = 0UL;
+  uint32_t period;
+  uint32_t high;
+  uint32_t rise;
+  uint32_t i;
+
+  for (i = 0UL; i < Count; i++)
+  {
+    rise = Record[i * hcap->Words];
+    if (hcap->Primed == 0UL)
+    {
+      hcap->LastRise = rise;
+      hcap->Primed = 1UL;
+      continue;
+    }
+
+    /* Modulo the counter range: one wrap between two edges is exact */
+    period = (rise - hcap->LastRise) & hcap->Mask;
+    if (hcap->Duty != 0UL)
+    {
+      high = (Record[(i * hcap->Words) + 1UL] - hcap->LastRise) & hcap->Mask;
+      if (high < period)
+      {
+        sumHigh += high;
+        sumDuty += period;
+      }
+      else
+      {
+        hcap->Stats.BadDuty++;
+      }
+    }
+    hcap->LastRise = rise;
+
+    if (periods == 0UL)
+    {
+      reference = period;
+    }
+    deviation = (int32_t)(period - reference);
+    deviations += deviation;
+    squares += (uint64_t)((int64_t)deviation * deviation);
+    sum += period;
+    if (period < shortest)
+    {
+      shortest = period;
+    }
+    if (period > longest)
+    {
+      longest = period;
+    }
+    periods++;
+  }
+
+  if (periods == 0UL)
+  {
+    return;
+  }
+
+  result->Periods = periods;
+  result->Period = (uint32_t)((sum + (periods / 2U)) / periods);
+  result->Frequency = (sum == 0U) ? 0UL :
+                      (uint32_t)(((uint64_t)hcap->TimerClock * 1000U * periods) / ((hcap->Prescaler + 1U) * sum));
+  result->DutyPpm = (sumDuty == 0U) ? 0UL : (uint32_t)((sumHigh * 1000000U) / sumDuty);
+  result->JitterPeak = longest - shortest;
+
+  /* Variance in Q16: mean of squares minus square of mean */
+  mean = (deviations * 256) / (int64_t)periods;
+  if ((squares > (UINT64_MAX >> 16U)) || (mean > INT32_MAX) || (mean < -INT32_MAX))
+  {
+    result->JitterRms = 0xFFFFFFFFUL;
+  }
+  else
+  {
+    variance = (int64_t)((squares << 16U) / periods) - (mean * mean);
+    result->JitterRms = (variance > 0) ? TIMCAP_Sqrt((uint64_t)variance) : 0UL;
+  }
+
+  hcap->Stats.Batches++;
+  hcap->Stats.Periods += periods;
+  if (hcap->Callback != NULL)
+  {
+    hcap->Callback(hcap, result);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Capture_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the timer captures and the DMA channel, left stopped.
+  * @note   The timer is fully reconfigured: counter range, CCMR1, CCER,
+  *         TISEL and DCR.
+  * @param  hcap capture engine handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus TIMCAP_Init(TIMCAP_HandleTypeDef *hcap)
+{
+  TIM_TypeDef *tim;
+  DMA_Channel_TypeDef *channel;
+  uint32_t ppre;
+  uint32_t ccmr;
+  uint32_t ccer;
+
+  if ((hcap == NULL) || (hcap->Instance == NULL) || (hcap->Channel == NULL) || (hcap->Buffer == NULL) ||
+      (hcap->NbRecords < 2UL) || ((hcap->NbRecords & 1UL) != 0UL) || (hcap->Duty > 1UL) ||
+      (hcap->Filter > TIMCAP_FILTER_MAX) || ((hcap->InputSelect & ~TIM_TISEL_TI1SEL) != 0UL) ||
+      (hcap->Prescaler > TIM_PSC_PSC) || ((hcap->Priority & ~DMA_CCR_PL) != 0UL))
+  {
+    return ERROR;
+  }
+
+  hcap->Words = hcap->Duty + 1UL;
+  if ((hcap->NbRecords * hcap->Words) > DMA_CNDTR_NDT)
+  {
+    return ERROR;
+  }
+
+  hcap->Mask = 0xFFFFUL;
+#if defined(TIM2)
+  if (hcap->Instance == TIM2)
+  {
+    hcap->Mask = 0xFFFFFFFFUL;
+  }
+#endif /* TIM2 */
+
+  if (hcap->TimerClock == 0UL)
+  {
+    /* TIMPCLK: PCLK, doubled when the APB prescaler divides */
+    ppre = APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE) >> RCC_CFGR_PPRE_Pos];
+    hcap->TimerClock = (ppre == 0UL) ? SystemCoreClock : ((SystemCoreClock >> ppre) * 2UL);
+  }
+
+  tim = hcap->Instance;
+  channel = hcap->Channel;
+
+  /* Free-running counter over the full range */
+  tim->CR1 = 0UL;
+  tim->DIER = 0UL;
+  tim->SMCR = 0UL;
+  tim->PSC = hcap->Prescaler;
+  tim->ARR = hcap->Mask;
+
+  /* CC1: TI1 rising edges; CC2: TI1 falling edges */
+  ccmr = TIM_CCMR1_CC1S_0 | (hcap->Filter << TIM_CCMR1_IC1F_Pos);
+  ccer = TIM_CCER_CC1E;
+  if (hcap->Duty != 0UL)
+  {
+    ccmr |= TIM_CCMR1_CC2S_1 | (hcap->Filter << TIM_CCMR1_IC2F_Pos);
+    ccer |= TIM_CCER_CC2E | TIM_CCER_CC2P;
+  }
+  tim->CCER = 0UL;
+  tim->CCMR1 = ccmr;
+  tim->CCER = ccer;
+  MODIFY_REG(tim->TISEL, TIM_TISEL_TI1SEL, hcap->InputSelect);
+  tim->EGR = TIM_EGR_UG;
+  tim->SR = 0UL;
+
+  /* One CC1 request moves CCR1, then CCR2 with the duty cycle */
+  if (hcap->Duty != 0UL)
+  {
+    tim->DCR = (TIMCAP_DBA_CCR1 << TIM_DCR_DBA_Pos) & TIM_DCR_DBA;
+    tim->DCR |= (1UL << TIM_DCR_DBL_Pos) & TIM_DCR_DBL;
+  }
+  else
+  {
+    tim->DCR = 0UL;
+  }
+
+  DMA_UTIL_EnableClock(channel);
+  channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(channel)->CCR = (hcap->Request << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  channel->CPAR = (hcap->Duty != 0UL) ? (uint32_t)&tim->DMAR : (uint32_t)&tim->CCR1;
+  channel->CMAR = (uint32_t)hcap->Buffer;
+  channel->CNDTR = hcap->NbRecords * hcap->Words;
+  channel->CCR = TIMCAP_CCR | hcap->Priority;
+
+  hcap->Primed = 0UL;
+  TIMCAP_ResetStats(hcap);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start the captures; the first edge only sets the reference.
+  * @param  hcap capture engine handle
+  * @retval None
+  */
+void TIMCAP_Start(TIMCAP_HandleTypeDef *hcap)
+{
+  hcap->Primed = 0UL;
+  hcap->Instance->SR = 0UL;
+  SET_BIT(hcap->Channel->CCR, DMA_CCR_EN);
+  SET_BIT(hcap->Instance->DIER, TIM_DIER_CC1DE);
+  SET_BIT(hcap->Instance->CR1, TIM_CR1_CEN);
+}
+
+/**
+  * @brief  Stop the captures and rewind the ring.
+  * @param  hcap capture engine handle
+  * @retval None
+  */
+void TIMCAP_Stop(TIMCAP_HandleTypeDef *hcap)
+{
+  CLEAR_BIT(hcap->Instance->CR1, TIM_CR1_CEN);
+  CLEAR_BIT(hcap->Instance->DIER, TIM_DIER_CC1DE);
+  CLEAR_BIT(hcap->Channel->CCR, DMA_CCR_EN);
+  DMA_UTIL_ClearFlags(hcap->Channel, DMA_UTIL_FLAG_ALL);
+  hcap->Channel->CNDTR = hcap->NbRecords * hcap->Words;
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  hcap capture engine handle
+  * @retval None
+  */
+void TIMCAP_DMA_IRQHandler(TIMCAP_HandleTypeDef *hcap)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hcap->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_HT | DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hcap->Channel, flags);
+    TIMCAP_FlagsHandler(hcap, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context capture engine handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void TIMCAP_FlagsHandler(void *Context, uint32_t Flags)
+{
+  TIMCAP_HandleTypeDef *hcap = (TIMCAP_HandleTypeDef *)Context;
+  uint32_t half = hcap->NbRecords / 2UL;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hcap->Stats.DmaErrors++;
+    return;
+  }
+
+  /* A lost edge merges two periods: count it, the batch still runs */
+  if ((hcap->Instance->SR & TIM_SR_CC1OF) != 0UL)
+  {
+    hcap->Instance->SR = ~TIM_SR_CC1OF;
+    hcap->Stats.Overcaptures++;
+  }
+
+  if ((Flags & DMA_UTIL_FLAG_HT) != 0UL)
+  {
+    TIMCAP_Process(hcap, hcap->Buffer, half);
+  }
+  if ((Flags & DMA_UTIL_FLAG_TC) != 0UL)
+  {
+    TIMCAP_Process(hcap, &hcap->Buffer[half * hcap->Words], half);
+  }
+}
+
+/**
+  * @brief  Reset the statistics.
+  * @param  hcap capture engine handle
+  * @retval None
+  */
+void TIMCAP_ResetStats(TIMCAP_HandleTypeDef *hcap)
+{
+  hcap->Stats.Batches = 0UL;
+  hcap->Stats.Periods = 0UL;
+  hcap->Stats.Overcaptures = 0UL;
+  hcap->Stats.BadDuty = 0UL;
+  hcap->Stats.DmaErrors = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
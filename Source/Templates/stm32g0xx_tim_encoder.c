@@ -0,0 +1,376 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_tim_encoder.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx timer quadrature encoder interface.
+  *
+  *   This file provides:
+  *      - TIMENC_Init() / Start() / Stop(): encoder mode, index capture and
+  *                                          CNT snapshot DMA setup.
+  *
+  *      - TIMENC_GetPosition() / TIMENC_GetIndex(): lazy 64-bit extension
+  *                                          of the counter and of the index
+  *                                          capture.
+  *
+  *      - TIMENC_GetVelocity(): counts per second over a window of the
+  *                              snapshot ring.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_tim_encoder
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_tim_encoder.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Private_Defines
+  * @{
+  */
+
+/* Word transfers from CNT, circular over the ring, no interrupt */
+#define TIMENC_CCR             (DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1)
+
+#define TIMENC_FILTER_MAX      (15UL)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Signed difference of two counter values.
+  * @param  henc encoder handle
+  * @param  From earlier value
+  * @param  To later value
+  * @retval Shortest move from From to To, within half the counter range
+  */
+static int32_t TIMENC_Delta(const TIMENC_HandleTypeDef *henc, uint32_t From, uint32_t To)
+{
+  uint32_t delta = (To - From) & henc->Mask;
+
+  /* Above half the range: a move backwards, wrapped within 32 bits */
+  if (delta > (henc->Mask >> 1U))
+  {
+    delta -= henc->Mask + 1UL;
+  }
+  return (int32_t)delta;
+}
+
+/**
+  * @brief  Bring the extended position up to the counter.
+  * @note   Called with interrupts masked.
+  * @param  henc encoder handle
+  * @retval None
+  */
+static void TIMENC_Update(TIMENC_HandleTypeDef *henc)
+{
+  uint32_t count = henc->Instance->CNT & henc->Mask;
+  int32_t step = TIMENC_Delta(henc, henc->LastCount, count);
+  uint32_t size = (step < 0) ? (0UL - (uint32_t)step) : (uint32_t)step;
+
+  henc->Position += step;
+  henc->LastCount = count;
+  henc->Stats.Reads++;
+  if (size > henc->Stats.MaxStep)
+  {
+    henc->Stats.MaxStep = size;
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_TIM_Encoder_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the encoder, left stopped at position 0.
+  * @note   The sampling trigger, e.g. a basic timer with UDE set, is
+  *         configured and started by the application.
+  * @param  henc encoder handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus TIMENC_Init(TIMENC_HandleTypeDef *henc)
+{
+  TIM_TypeDef *tim;
+  DMA_Channel_TypeDef *channel;
+  uint32_t ccer;
+
+  if ((henc == NULL) || (henc->Instance == NULL) || ((henc->Mode & ~TIM_SMCR_SMS) != 0UL) ||
+      (henc->Mode == 0UL) || (henc->Filter > TIMENC_FILTER_MAX) ||
+      ((henc->Priority & ~DMA_CCR_PL) != 0UL))
+  {
+    return ERROR;
+  }
+  if ((henc->SampleChannel != NULL) &&
+      ((henc->Samples == NULL) || (henc->NbSamples < 2UL) || (henc->NbSamples > DMA_CNDTR_NDT) ||
+       (henc->SampleRate == 0UL)))
+  {
+    return ERROR;
+  }
+
+  henc->Mask = 0xFFFFUL;
+#if defined(TIM2)
+  if (henc->Instance == TIM2)
+  {
+    henc->Mask = 0xFFFFFFFFUL;
+  }
+#endif /* TIM2 */
+
+  tim = henc->Instance;
+
+  /* TI1 on CC1, TI2 on CC2, both counted by the slave mode controller */
+  tim->CR1 = 0UL;
+  tim->DIER = 0UL;
+  tim->SMCR = 0UL;
+  tim->CCER = 0UL;
+  tim->PSC = 0UL;
+  tim->ARR = henc->Mask;
+  tim->CCMR1 = TIM_CCMR1_CC1S_0 | (henc->Filter << TIM_CCMR1_IC1F_Pos) |
+               TIM_CCMR1_CC2S_0 | (henc->Filter << TIM_CCMR1_IC2F_Pos);
+  ccer = (henc->Invert != 0UL) ? TIM_CCER_CC1P : 0UL;
+
+  /* Index: CC3 captures the count on TI3 rising edges */
+  if (henc->Index != 0UL)
+  {
+    tim->CCMR2 = TIM_CCMR2_CC3S_0 | (henc->Filter << TIM_CCMR2_IC3F_Pos);
+    ccer |= TIM_CCER_CC3E;
+  }
+  tim->CCER = ccer;
+  tim->SMCR = henc->Mode;
+  tim->EGR = TIM_EGR_UG;
+  tim->SR = 0UL;
+
+  if (henc->SampleChannel != NULL)
+  {
+    channel = henc->SampleChannel;
+    DMA_UTIL_EnableClock(channel);
+    channel->CCR = 0UL;
+    DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+    DMA_UTIL_GetMuxChannel(channel)->CCR = (henc->SampleRequest << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+    channel->CPAR = (uint32_t)&tim->CNT;
+    channel->CMAR = (uint32_t)henc->Samples;
+    channel->CNDTR = henc->NbSamples;
+    channel->CCR = TIMENC_CCR | henc->Priority;
+  }
+
+  henc->LastCount = 0UL;
+  henc->Position = 0;
+  TIMENC_ResetStats(henc);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start counting and sampling.
+  * @note   The snapshot ring is filled with the current count first, so that
+  *         the velocity reads 0 until the window has been sampled.
+  * @param  henc encoder handle
+  * @retval None
+  */
+void TIMENC_Start(TIMENC_HandleTypeDef *henc)
+{
+  uint32_t count = henc->Instance->CNT & henc->Mask;
+  uint32_t i;
+
+  if (henc->SampleChannel != NULL)
+  {
+    for (i = 0UL; i < henc->NbSamples; i++)
+    {
+      henc->Samples[i] = count;
+    }
+    SET_BIT(henc->SampleChannel->CCR, DMA_CCR_EN);
+  }
+  SET_BIT(henc->Instance->CR1, TIM_CR1_CEN);
+}
+
+/**
+  * @brief  Stop counting and sampling; the position is kept.
+  * @param  henc encoder handle
+  * @retval None
+  */
+void TIMENC_Stop(TIMENC_HandleTypeDef *henc)
+{
+  CLEAR_BIT(henc->Instance->CR1, TIM_CR1_CEN);
+  if (henc->SampleChannel != NULL)
+  {
+    CLEAR_BIT(henc->SampleChannel->CCR, DMA_CCR_EN);
+    henc->SampleChannel->CNDTR = henc->NbSamples;
+  }
+}
+
+/**
+  * @brief  Return the 64-bit position.
+  * @note   Exact while the encoder moves less than half the counter range
+  *         between two reads of the position or of the index.
+  * @param  henc encoder handle
+  * @retval Position in counts
+  */
+int64_t TIMENC_GetPosition(TIMENC_HandleTypeDef *henc)
+{
+  uint32_t primask = __get_PRIMASK();
+  int64_t position;
+
+  __disable_irq();
+  TIMENC_Update(henc);
+  position = henc->Position;
+  __set_PRIMASK(primask);
+
+  return position;
+}
+
+/**
+  * @brief  Return the low 32 bits of the position.
+  * @param  henc encoder handle
+  * @retval Position in counts, wrapping
+  */
+int32_t TIMENC_GetPosition32(TIMENC_HandleTypeDef *henc)
+{
+  return (int32_t)(uint32_t)(uint64_t)TIMENC_GetPosition(henc);
+}
+
+/**
+  * @brief  Set the position, e.g. to 0 at a homing index.
+  * @param  henc encoder handle
+  * @param  Position new position of the current count
+  * @retval None
+  */
+void TIMENC_SetPosition(TIMENC_HandleTypeDef *henc, int64_t Position)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  TIMENC_Update(henc);
+  henc->Position = Position;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Return the position of the last index pulse, when a new one
+  *         occurred since the previous call.
+  * @note   Reading CCR3 clears CC3IF. The capture must lie within half the
+  *         counter range of the current count.
+  * @param  henc encoder handle
+  * @param  Position position at the index, left unchanged without a new one
+  * @retval 1 on a new index pulse, 0 otherwise
+  */
+uint32_t TIMENC_GetIndex(TIMENC_HandleTypeDef *henc, int64_t *Position)
+{
+  uint32_t primask;
+  uint32_t capture;
+
+  if ((henc->Instance->SR & TIM_SR_CC3IF) == 0UL)
+  {
+    return 0UL;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  capture = henc->Instance->CCR3 & henc->Mask;
+  TIMENC_Update(henc);
+  *Position = henc->Position + TIMENC_Delta(henc, henc->LastCount, capture);
+  henc->Stats.Indexes++;
+  __set_PRIMASK(primask);
+
+  return 1UL;
+}
+
+/**
+  * @brief  Compute the velocity over the last Window sampling periods.
+  * @note   The newest snapshot is located from the DMA counter. The result
+  *         is in counts per second, Q24.8, saturated.
+  * @param  henc encoder handle
+  * @param  Window sampling periods, 1 to NbSamples - 1
+  * @param  Velocity velocity, positive when counting up
+  * @retval SUCCESS, or ERROR without sampling or on an invalid window
+  */
+ErrorStatus TIMENC_GetVelocity(const TIMENC_HandleTypeDef *henc, uint32_t Window, int32_t *Velocity)
+{
+  uint32_t size = henc->NbSamples;
+  uint32_t newest;
+  uint32_t oldest;
+  int64_t velocity;
+
+  if ((henc->SampleChannel == NULL) || (Window == 0UL) || (Window >= size))
+  {
+    return ERROR;
+  }
+
+  /* CNDTR counts down from size: the slot before the next write is done */
+  newest = ((size - henc->SampleChannel->CNDTR) + size - 1UL) % size;
+  oldest = (newest + size - Window) % size;
+
+  velocity = ((int64_t)TIMENC_Delta(henc, henc->Samples[oldest], henc->Samples[newest]) *
+              (int64_t)henc->SampleRate * 256) / (int64_t)Window;
+  if (velocity > INT32_MAX)
+  {
+    velocity = INT32_MAX;
+  }
+  else if (velocity < -INT32_MAX)
+  {
+    velocity = -INT32_MAX;
+  }
+  else
+  {
+    /* In range */
+  }
+  *Velocity = (int32_t)velocity;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reset the statistics.
+  * @param  henc encoder handle
+  * @retval None
+  */
+void TIMENC_ResetStats(TIMENC_HandleTypeDef *henc)
+{
+  henc->Stats.Reads = 0UL;
+  henc->Stats.Indexes = 0UL;
+  henc->Stats.MaxStep = 0UL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,450 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_baud.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx precomputed USART / LPUART baud rate tables.
+  *
+  *   This file provides:
+  *      - the constant BRR / PRESC tables, one row per kernel clock
+  *        operating point, computed by the preprocessor and the compiler.
+  *
+  *      - USARTBAUD_GetKernelClock(): kernel clock of an instance from its
+  *                                    RCC_CCIPR selection.
+  *
+  *      - USARTBAUD_Lookup() / USARTBAUD_Set(): register values and error for
+  *                                    a baud rate, the row being revalidated
+  *                                    against the current kernel clock.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_baud
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_usart_baud.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Private_Defines
+  * @{
+  */
+
+#if !defined  (HSI_VALUE)
+  #define HSI_VALUE  (16000000UL)   /*!< Value of the Internal oscillator in Hz*/
+#endif /* HSI_VALUE */
+
+#if !defined  (LSE_VALUE)
+  #define LSE_VALUE  (32768UL)      /*!< Value of LSE in Hz*/
+#endif /* LSE_VALUE */
+
+/* Kernel clock selections, RCC_CCIPR USARTxSEL / LPUARTxSEL encoding */
+#define USARTBAUD_SEL_PCLK     (0UL)
+#define USARTBAUD_SEL_SYSCLK   (1UL)
+#define USARTBAUD_SEL_HSI16    (2UL)
+#define USARTBAUD_SEL_LSE      (3UL)
+
+#define USARTBAUD_LPUART_PRESC_MAX  (11UL)
+#define USARTBAUD_LPUART_BRR_MAX    (0xFFFFFUL)
+
+/* Table entries */
+#define USARTBAUD_USART_ENTRY(FCK, BAUD) \
+  { USARTBAUD_USART_BRR(FCK, BAUD), 0U, USARTBAUD_ERROR_PPM(FCK, USARTBAUD_USART_BRR(FCK, BAUD), BAUD) },
+
+#define USARTBAUD_LPUART_ENTRY(FCK, BAUD) \
+  { USARTBAUD_LPUART_BRR(FCK, BAUD), USARTBAUD_LPUART_PRESC(FCK, BAUD), \
+    USARTBAUD_ERROR_PPM((uint64_t)(FCK) * 256U, \
+                        (uint64_t)USARTBAUD_LPUART_BRR(FCK, BAUD) * \
+                        USARTBAUD_PRESC_DIV(USARTBAUD_LPUART_PRESC(FCK, BAUD)), BAUD) },
+
+#define USARTBAUD_USART_ROW(FCK)   { (FCK), { USARTBAUD_RATES(USARTBAUD_USART_ENTRY, FCK) } }
+#define USARTBAUD_LPUART_ROW(FCK)  { (FCK), { USARTBAUD_RATES(USARTBAUD_LPUART_ENTRY, FCK) } }
+
+#define USARTBAUD_RATE_VALUE(ARG, BAUD)  (BAUD),
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Private_Variables
+  * @{
+  */
+
+static const uint32_t USARTBAUD_Rates[USARTBAUD_NB_RATES] =
+{
+  USARTBAUD_RATES(USARTBAUD_RATE_VALUE, 0U)
+};
+
+/* SYSCLK / PCLK operating points: PLL 64 and 48 MHz, HSI16 and its dividers */
+static const USARTBAUD_RowTypeDef USARTBAUD_UsartTable[] =
+{
+  USARTBAUD_USART_ROW(64000000UL),
+  USARTBAUD_USART_ROW(48000000UL),
+  USARTBAUD_USART_ROW(32000000UL),
+  USARTBAUD_USART_ROW(24000000UL),
+  USARTBAUD_USART_ROW(16000000UL),
+  USARTBAUD_USART_ROW(8000000UL),
+  USARTBAUD_USART_ROW(4000000UL),
+  USARTBAUD_USART_ROW(2000000UL),
+  USARTBAUD_USART_ROW(1000000UL),
+};
+
+#if defined(LPUART1)
+/* Same operating points, plus LSE for reception in Stop mode */
+static const USARTBAUD_RowTypeDef USARTBAUD_LpuartTable[] =
+{
+  USARTBAUD_LPUART_ROW(64000000UL),
+  USARTBAUD_LPUART_ROW(48000000UL),
+  USARTBAUD_LPUART_ROW(32000000UL),
+  USARTBAUD_LPUART_ROW(24000000UL),
+  USARTBAUD_LPUART_ROW(16000000UL),
+  USARTBAUD_LPUART_ROW(8000000UL),
+  USARTBAUD_LPUART_ROW(4000000UL),
+  USARTBAUD_LPUART_ROW(2000000UL),
+  USARTBAUD_LPUART_ROW(1000000UL),
+  USARTBAUD_LPUART_ROW(LSE_VALUE),
+};
+#endif /* LPUART1 */
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Tell whether an instance is a low-power UART.
+  * @param  Instance USART or LPUART instance
+  * @retval 1 for LPUART instances, 0 otherwise
+  */
+static uint32_t USARTBAUD_IsLpuart(const USART_TypeDef *Instance)
+{
+#if defined(LPUART2)
+  if (Instance == LPUART2)
+  {
+    return 1UL;
+  }
+#endif /* LPUART2 */
+#if defined(LPUART1)
+  if (Instance == LPUART1)
+  {
+    return 1UL;
+  }
+#else
+  (void)Instance;
+#endif /* LPUART1 */
+  return 0UL;
+}
+
+/**
+  * @brief  Compute the register values of one rate at run time.
+  * @param  IsLpuart LPUART BRR format
+  * @param  KernelClock kernel clock in Hz
+  * @param  Baud baud rate
+  * @param  Entry computed values, Brr = 0 when unreachable
+  * @retval None
+  */
+static void USARTBAUD_Compute(uint32_t IsLpuart, uint32_t KernelClock, uint32_t Baud, USARTBAUD_EntryTypeDef *Entry)
+{
+  uint64_t num = KernelClock;
+  uint64_t den;
+  uint32_t code = 0UL;
+  uint32_t brr;
+
+  Entry->Brr = 0UL;
+  Entry->Presc = 0UL;
+  Entry->ErrorPpm = 0;
+
+  if (IsLpuart != 0UL)
+  {
+    num *= 256U;
+    do
+    {
+      brr = (uint32_t)USARTBAUD_DIV_ROUND(num, (uint64_t)USARTBAUD_PRESC_DIV(code) * Baud);
+      if (brr <= USARTBAUD_LPUART_BRR_MAX)
+      {
+        break;
+      }
+      code++;
+    } while (code <= USARTBAUD_LPUART_PRESC_MAX);
+    if ((code > USARTBAUD_LPUART_PRESC_MAX) || (brr < 0x300UL))
+    {
+      return;
+    }
+    den = (uint64_t)brr * USARTBAUD_PRESC_DIV(code);
+  }
+  else
+  {
+    brr = USARTBAUD_DIV_ROUND(KernelClock, Baud);
+    if ((brr < 16UL) || (brr > 0xFFFFUL))
+    {
+      return;
+    }
+    den = brr;
+  }
+
+  Entry->Brr = brr;
+  Entry->Presc = code;
+  Entry->ErrorPpm = (int32_t)((((int64_t)num * 1000000 / (int64_t)den) - ((int64_t)Baud * 1000000)) / (int64_t)Baud);
+}
+
+/**
+  * @brief  Revalidate the cached row against the current kernel clock.
+  * @param  hbaud baud rate cache
+  * @retval None
+  */
+static void USARTBAUD_Refresh(USARTBAUD_HandleTypeDef *hbaud)
+{
+  const USARTBAUD_RowTypeDef *table = USARTBAUD_UsartTable;
+  uint32_t count = sizeof(USARTBAUD_UsartTable) / sizeof(USARTBAUD_UsartTable[0]);
+  uint32_t clock = USARTBAUD_GetKernelClock(hbaud->Instance);
+  uint32_t i;
+
+  if ((hbaud->Row != NULL) && (clock == hbaud->KernelClock))
+  {
+    return;
+  }
+
+  hbaud->Stats.Rebuilds++;
+  hbaud->KernelClock = clock;
+  hbaud->Row = NULL;
+
+#if defined(LPUART1)
+  if (hbaud->IsLpuart != 0UL)
+  {
+    table = USARTBAUD_LpuartTable;
+    count = sizeof(USARTBAUD_LpuartTable) / sizeof(USARTBAUD_LpuartTable[0]);
+  }
+#endif /* LPUART1 */
+
+  for (i = 0UL; i < count; i++)
+  {
+    if (table[i].KernelClock == clock)
+    {
+      hbaud->Row = &table[i];
+      return;
+    }
+  }
+
+  /* Unlisted operating point: build the row once */
+  hbaud->Computed.KernelClock = clock;
+  for (i = 0UL; i < USARTBAUD_NB_RATES; i++)
+  {
+    USARTBAUD_Compute(hbaud->IsLpuart, clock, USARTBAUD_Rates[i], &hbaud->Computed.Entry[i]);
+  }
+  hbaud->Row = &hbaud->Computed;
+  hbaud->Stats.RowsComputed++;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_Baud_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize a baud rate cache.
+  * @param  hbaud baud rate cache
+  * @param  Instance USART or LPUART instance
+  * @retval SUCCESS or ERROR on an invalid parameter
+  */
+ErrorStatus USARTBAUD_Init(USARTBAUD_HandleTypeDef *hbaud, USART_TypeDef *Instance)
+{
+  if ((hbaud == NULL) || (Instance == NULL))
+  {
+    return ERROR;
+  }
+
+  hbaud->Instance = Instance;
+  hbaud->IsLpuart = USARTBAUD_IsLpuart(Instance);
+  hbaud->KernelClock = 0UL;
+  hbaud->Row = NULL;
+  hbaud->Stats.Lookups = 0UL;
+  hbaud->Stats.Rebuilds = 0UL;
+  hbaud->Stats.RowsComputed = 0UL;
+  hbaud->Stats.Divisions = 0UL;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Return the kernel clock of a USART or LPUART instance.
+  * @note   Relies on SystemCoreClock being up to date. Instances without a
+  *         clock selection field run from PCLK.
+  * @param  Instance USART or LPUART instance
+  * @retval Kernel clock in Hz
+  */
+uint32_t USARTBAUD_GetKernelClock(const USART_TypeDef *Instance)
+{
+  uint32_t ccipr = RCC->CCIPR;
+  uint32_t sel = USARTBAUD_SEL_PCLK;
+  uint32_t clock;
+
+  if (Instance == USART1)
+  {
+    sel = (ccipr & RCC_CCIPR_USART1SEL) >> RCC_CCIPR_USART1SEL_Pos;
+  }
+#if defined(RCC_CCIPR_USART2SEL)
+  else if (Instance == USART2)
+  {
+    sel = (ccipr & RCC_CCIPR_USART2SEL) >> RCC_CCIPR_USART2SEL_Pos;
+  }
+#endif /* RCC_CCIPR_USART2SEL */
+#if defined(RCC_CCIPR_USART3SEL)
+  else if (Instance == USART3)
+  {
+    sel = (ccipr & RCC_CCIPR_USART3SEL) >> RCC_CCIPR_USART3SEL_Pos;
+  }
+#endif /* RCC_CCIPR_USART3SEL */
+#if defined(LPUART1)
+  else if (Instance == LPUART1)
+  {
+    sel = (ccipr & RCC_CCIPR_LPUART1SEL) >> RCC_CCIPR_LPUART1SEL_Pos;
+  }
+#endif /* LPUART1 */
+#if defined(LPUART2)
+  else if (Instance == LPUART2)
+  {
+    sel = (ccipr & RCC_CCIPR_LPUART2SEL) >> RCC_CCIPR_LPUART2SEL_Pos;
+  }
+#endif /* LPUART2 */
+  else
+  {
+    /* PCLK only */
+  }
+
+  switch (sel)
+  {
+    case USARTBAUD_SEL_SYSCLK:
+      clock = SystemCoreClock << AHBPrescTable[(RCC->CFGR & RCC_CFGR_HPRE) >> RCC_CFGR_HPRE_Pos];
+      break;
+    case USARTBAUD_SEL_HSI16:
+      clock = HSI_VALUE;
+      break;
+    case USARTBAUD_SEL_LSE:
+      clock = LSE_VALUE;
+      break;
+    default:
+      clock = SystemCoreClock >> APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE) >> RCC_CFGR_PPRE_Pos];
+      break;
+  }
+
+  return clock;
+}
+
+/**
+  * @brief  Return the register values and error for a baud rate.
+  * @param  hbaud baud rate cache
+  * @param  Baud baud rate
+  * @param  Entry register values and error
+  * @retval SUCCESS, or ERROR when the rate is not reachable
+  */
+ErrorStatus USARTBAUD_Lookup(USARTBAUD_HandleTypeDef *hbaud, uint32_t Baud, USARTBAUD_EntryTypeDef *Entry)
+{
+  uint32_t i;
+
+  if (Baud == 0UL)
+  {
+    return ERROR;
+  }
+
+  USARTBAUD_Refresh(hbaud);
+  hbaud->Stats.Lookups++;
+
+  for (i = 0UL; i < USARTBAUD_NB_RATES; i++)
+  {
+    if (USARTBAUD_Rates[i] == Baud)
+    {
+      *Entry = hbaud->Row->Entry[i];
+      return (Entry->Brr != 0UL) ? SUCCESS : ERROR;
+    }
+  }
+
+  hbaud->Stats.Divisions++;
+  USARTBAUD_Compute(hbaud->IsLpuart, hbaud->KernelClock, Baud, Entry);
+
+  return (Entry->Brr != 0UL) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Program BRR and PRESC for a baud rate.
+  * @note   The instance is disabled while BRR and PRESC are written, then
+  *         restored; no transfer must be in progress.
+  * @param  hbaud baud rate cache
+  * @param  Baud baud rate
+  * @param  ErrorPpm achieved rate error in ppm, may be NULL
+  * @retval SUCCESS, or ERROR when the rate is not reachable
+  */
+ErrorStatus USARTBAUD_Set(USARTBAUD_HandleTypeDef *hbaud, uint32_t Baud, int32_t *ErrorPpm)
+{
+  USART_TypeDef *usart = hbaud->Instance;
+  USARTBAUD_EntryTypeDef entry;
+  uint32_t ue;
+
+  if (USARTBAUD_Lookup(hbaud, Baud, &entry) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  ue = usart->CR1 & USART_CR1_UE;
+  CLEAR_BIT(usart->CR1, USART_CR1_UE);
+  usart->PRESC = entry.Presc;
+  usart->BRR = entry.Brr;
+  SET_BIT(usart->CR1, ue);
+
+  if (ErrorPpm != NULL)
+  {
+    *ErrorPpm = entry.ErrorPpm;
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Drop the cached row; the next lookup selects it again.
+  * @param  hbaud baud rate cache
+  * @retval None
+  */
+void USARTBAUD_Invalidate(USARTBAUD_HandleTypeDef *hbaud)
+{
+  hbaud->Row = NULL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,342 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_dmarx.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx zero-copy USART receive.
+  *
+  *   This file provides:
+  *      - USARTRX_Init(): configures the circular DMA channel and the frame
+  *                        end detection of the USART.
+  *
+  *      - USARTRX_USART_IRQHandler(): USART vector, receiver timeout or idle
+  *                                    line, error accounting.
+  *
+  *      - USARTRX_DMA_IRQHandler(): DMA vector, half and full ring events.
+  *
+  *   All events share one drain routine comparing the DMA write position
+  *   (ring size - CNDTR) with the last delivered position. The per byte
+  *   cost on the CPU is nil; the per event cost is one CNDTR read and one or
+  *   two callbacks.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_dmarx
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_USART_DMARX_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_usart_dmarx.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMARX_Private_Defines
+  * @{
+  */
+
+#define USARTRX_ERROR_FLAGS    (USART_ISR_PE | USART_ISR_FE | USART_ISR_NE)
+#define USARTRX_ERROR_CLEAR    (USART_ICR_PECF | USART_ICR_FECF | USART_ICR_NECF)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMARX_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Tell whether an instance has the receiver timeout (RTOR).
+  * @note   RTOR comes with the full USART feature set, the instances
+  *         that also support LIN; LPUARTs and basic USARTs lack it.
+  * @param  Instance USART or LPUART instance
+  * @retval 1 when RTOR is implemented, 0 otherwise
+  */
+static uint32_t USARTRX_HasTimeout(const USART_TypeDef *Instance)
+{
+  return (IS_UART_LIN_INSTANCE(Instance) != 0) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Deliver one span.
+  * @param  hrx receiver handle
+  * @param  Offset span start in the ring
+  * @param  Length span length
+  * @param  Event USARTRX_EVENT_xx
+  * @retval None
+  */
+static void USARTRX_Deliver(USARTRX_HandleTypeDef *hrx, uint32_t Offset, uint32_t Length, uint32_t Event)
+{
+  hrx->Stats.Bytes += Length;
+  hrx->Stats.Spans++;
+  hrx->SpanCallback(hrx, &hrx->Buffer[Offset], Length, Event);
+}
+
+/**
+  * @brief  Deliver everything written by the DMA since the last call.
+  * @param  hrx receiver handle
+  * @param  Event USARTRX_EVENT_xx
+  * @retval None
+  */
+static void USARTRX_Drain(USARTRX_HandleTypeDef *hrx, uint32_t Event)
+{
+  uint32_t head = hrx->Size - (hrx->Channel->CNDTR & DMA_CNDTR_NDT);
+  uint32_t tail = hrx->Tail;
+
+  if (head == hrx->Size)
+  {
+    head = 0UL;
+  }
+  if (head == tail)
+  {
+    return;
+  }
+
+  if (head > tail)
+  {
+    USARTRX_Deliver(hrx, tail, head - tail, Event);
+  }
+  else
+  {
+    USARTRX_Deliver(hrx, tail, hrx->Size - tail, Event);
+    if (head != 0UL)
+    {
+      USARTRX_Deliver(hrx, 0UL, head, Event);
+    }
+  }
+  hrx->Tail = head;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMARX_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the receiver.
+  * @note   The USART is disabled while its frame end detection is configured.
+  *         The receiver timeout is not available on LPUART instances nor
+  *         on basic USARTs, which must use USARTRX_FRAMING_IDLE.
+  * @param  hrx receiver handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus USARTRX_Init(USARTRX_HandleTypeDef *hrx)
+{
+  USART_TypeDef *usart;
+  DMA_Channel_TypeDef *channel;
+
+  if ((hrx == NULL) || (hrx->Instance == NULL) || (hrx->Channel == NULL) ||
+      (hrx->Buffer == NULL) || (hrx->SpanCallback == NULL) ||
+      (hrx->Size < 2UL) || (hrx->Size > DMA_CNDTR_NDT) || ((hrx->Size & 1UL) != 0UL))
+  {
+    return ERROR;
+  }
+  if ((hrx->Framing == USARTRX_FRAMING_TIMEOUT) &&
+      ((USARTRX_HasTimeout(hrx->Instance) == 0UL) || (hrx->TimeoutBits > USART_RTOR_RTO)))
+  {
+    return ERROR;
+  }
+
+  usart = hrx->Instance;
+  channel = hrx->Channel;
+
+  /* DMA: peripheral to memory, byte, circular, half and full events */
+  DMA_UTIL_EnableClock(channel);
+  channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(channel)->CCR = (hrx->Request << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  channel->CPAR = (uint32_t)&usart->RDR;
+  channel->CMAR = (uint32_t)hrx->Buffer;
+  channel->CNDTR = hrx->Size;
+  channel->CCR = DMA_CCR_MINC | DMA_CCR_CIRC | DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_TEIE;
+
+  /* USART: frame end detection and error interrupts, left disabled */
+  CLEAR_BIT(usart->CR1, USART_CR1_UE);
+  if (hrx->Framing == USARTRX_FRAMING_TIMEOUT)
+  {
+    usart->RTOR = (usart->RTOR & ~USART_RTOR_RTO) | hrx->TimeoutBits;
+    SET_BIT(usart->CR2, USART_CR2_RTOEN);
+    MODIFY_REG(usart->CR1, USART_CR1_IDLEIE, USART_CR1_RTOIE | USART_CR1_PEIE | USART_CR1_RE);
+  }
+  else
+  {
+    if (USARTRX_HasTimeout(usart) != 0UL)
+    {
+      CLEAR_BIT(usart->CR2, USART_CR2_RTOEN);
+    }
+    MODIFY_REG(usart->CR1, USART_CR1_RTOIE, USART_CR1_IDLEIE | USART_CR1_PEIE | USART_CR1_RE);
+  }
+  SET_BIT(usart->CR3, USART_CR3_EIE);
+
+  hrx->Tail = 0UL;
+  hrx->Stats.Bytes = 0UL;
+  hrx->Stats.Spans = 0UL;
+  hrx->Stats.Frames = 0UL;
+  hrx->Stats.Interrupts = 0UL;
+  hrx->Stats.Overruns = 0UL;
+  hrx->Stats.LineErrors = 0UL;
+  hrx->Stats.DmaErrors = 0UL;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Start receiving.
+  * @param  hrx receiver handle
+  * @retval None
+  */
+void USARTRX_Start(USARTRX_HandleTypeDef *hrx)
+{
+  USART_TypeDef *usart = hrx->Instance;
+
+  hrx->Tail = hrx->Size - (hrx->Channel->CNDTR & DMA_CNDTR_NDT);
+  SET_BIT(hrx->Channel->CCR, DMA_CCR_EN);
+  usart->ICR = USART_ICR_RTOCF | USART_ICR_IDLECF | USART_ICR_ORECF | USARTRX_ERROR_CLEAR;
+  SET_BIT(usart->CR3, USART_CR3_DMAR);
+  SET_BIT(usart->CR1, USART_CR1_UE);
+}
+
+/**
+  * @brief  Stop receiving; pending data are delivered first.
+  * @param  hrx receiver handle
+  * @retval None
+  */
+void USARTRX_Stop(USARTRX_HandleTypeDef *hrx)
+{
+  CLEAR_BIT(hrx->Instance->CR3, USART_CR3_DMAR);
+  USARTRX_Poll(hrx);
+  CLEAR_BIT(hrx->Channel->CCR, DMA_CCR_EN);
+  DMA_UTIL_ClearFlags(hrx->Channel, DMA_UTIL_FLAG_ALL);
+}
+
+/**
+  * @brief  Deliver pending data from thread context.
+  * @note   The span callback runs with interrupts masked.
+  * @param  hrx receiver handle
+  * @retval None
+  */
+void USARTRX_Poll(USARTRX_HandleTypeDef *hrx)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  USARTRX_Drain(hrx, USARTRX_EVENT_POLL);
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Handle the USART interrupt.
+  * @param  hrx receiver handle
+  * @retval None
+  */
+void USARTRX_USART_IRQHandler(USARTRX_HandleTypeDef *hrx)
+{
+  USART_TypeDef *usart = hrx->Instance;
+  uint32_t isr = usart->ISR;
+
+  hrx->Stats.Interrupts++;
+
+  if ((isr & USART_ISR_ORE) != 0UL)
+  {
+    usart->ICR = USART_ICR_ORECF;
+    hrx->Stats.Overruns++;
+  }
+  if ((isr & USARTRX_ERROR_FLAGS) != 0UL)
+  {
+    usart->ICR = USARTRX_ERROR_CLEAR;
+    hrx->Stats.LineErrors++;
+  }
+
+  if ((isr & (USART_ISR_RTOF | USART_ISR_IDLE)) != 0UL)
+  {
+    usart->ICR = USART_ICR_RTOCF | USART_ICR_IDLECF;
+    hrx->Stats.Frames++;
+    USARTRX_Drain(hrx, USARTRX_EVENT_FRAME);
+  }
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  hrx receiver handle
+  * @retval None
+  */
+void USARTRX_DMA_IRQHandler(USARTRX_HandleTypeDef *hrx)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(hrx->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_HT | DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(hrx->Channel, flags);
+    USARTRX_FlagsHandler(hrx, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context receiver handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void USARTRX_FlagsHandler(void *Context, uint32_t Flags)
+{
+  USARTRX_HandleTypeDef *hrx = (USARTRX_HandleTypeDef *)Context;
+
+  hrx->Stats.Interrupts++;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    hrx->Stats.DmaErrors++;
+    return;
+  }
+  if ((Flags & DMA_UTIL_FLAG_TC) != 0UL)
+  {
+    USARTRX_Drain(hrx, USARTRX_EVENT_FULL);
+  }
+  else if ((Flags & DMA_UTIL_FLAG_HT) != 0UL)
+  {
+    USARTRX_Drain(hrx, USARTRX_EVENT_HALF);
+  }
+  else
+  {
+    /* No data event */
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
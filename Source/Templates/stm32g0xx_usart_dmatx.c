@@ -0,0 +1,397 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_dmatx.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx scatter-gather USART transmit queue.
+  *
+  *   This file provides:
+  *      - USARTTX_Init(): configures the DMA channel towards USART_TDR.
+  *
+  *      - USARTTX_Send(): turns a fragment array into queued segments, all
+  *                        or nothing, and starts the channel when idle.
+  *
+  *      - USARTTX_IRQHandler(): DMA vector; reloads the next segment first,
+  *                              then releases bounce space and reports
+  *                              completed frames.
+  *
+  *   USARTTX_Send() is the only producer and the DMA interrupt the only
+  *   consumer of the segment and bounce rings, so the interrupt is only
+  *   masked around the idle channel restart.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_dmatx
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_USART_DMATX_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_usart_dmatx.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMATX_Private_Defines
+  * @{
+  */
+
+/* Memory to peripheral, byte, memory increment; EN is added on load */
+#define USARTTX_CCR            (DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_TCIE | DMA_CCR_TEIE)
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMATX_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Tell whether a ring size is a non zero power of two.
+  * @param  Size ring size
+  * @retval 1 when valid, 0 otherwise
+  */
+static uint32_t USARTTX_IsPow2(uint32_t Size)
+{
+  return ((Size != 0UL) && ((Size & (Size - 1UL)) == 0UL)) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Load a segment into the channel and enable it.
+  * @param  htx transmit queue handle
+  * @param  Segment segment to transfer
+  * @retval None
+  */
+__STATIC_INLINE void USARTTX_Load(const USARTTX_HandleTypeDef *htx, const USARTTX_SegmentTypeDef *Segment)
+{
+  DMA_Channel_TypeDef *channel = htx->Channel;
+
+  channel->CCR = USARTTX_CCR;
+  channel->CNDTR = Segment->Length;
+  channel->CMAR = (uint32_t)Segment->Data;
+  channel->CCR = USARTTX_CCR | DMA_CCR_EN;
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_DMATX_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the transmit queue and enable the USART transmitter.
+  * @param  htx transmit queue handle
+  * @retval SUCCESS or ERROR on an invalid configuration
+  */
+ErrorStatus USARTTX_Init(USARTTX_HandleTypeDef *htx)
+{
+  DMA_Channel_TypeDef *channel;
+
+  if ((htx == NULL) || (htx->Instance == NULL) || (htx->Channel == NULL) ||
+      (htx->Segments == NULL) || (USARTTX_IsPow2(htx->NbSegments) == 0UL))
+  {
+    return ERROR;
+  }
+  if ((htx->Bounce != NULL) &&
+      ((USARTTX_IsPow2(htx->BounceSize) == 0UL) || (htx->CoalesceThreshold > htx->BounceSize)))
+  {
+    return ERROR;
+  }
+
+  channel = htx->Channel;
+  DMA_UTIL_EnableClock(channel);
+  channel->CCR = 0UL;
+  DMA_UTIL_ClearFlags(channel, DMA_UTIL_FLAG_ALL);
+  DMA_UTIL_GetMuxChannel(channel)->CCR = (htx->Request << DMAMUX_CxCR_DMAREQ_ID_Pos) & DMAMUX_CxCR_DMAREQ_ID;
+  channel->CPAR = (uint32_t)&htx->Instance->TDR;
+
+  htx->SegHead = 0UL;
+  htx->SegTail = 0UL;
+  htx->BounceHead = 0UL;
+  htx->BounceTail = 0UL;
+  htx->Busy = 0UL;
+  htx->Failed = 0UL;
+  htx->PendingFrames = 0UL;
+  htx->Stats.Frames = 0UL;
+  htx->Stats.Fragments = 0UL;
+  htx->Stats.Segments = 0UL;
+  htx->Stats.CoalescedBytes = 0UL;
+  htx->Stats.Rejected = 0UL;
+  htx->Stats.Interrupts = 0UL;
+  htx->Stats.Callbacks = 0UL;
+  htx->Stats.Errors = 0UL;
+
+  SET_BIT(htx->Instance->CR3, USART_CR3_DMAT);
+  SET_BIT(htx->Instance->CR1, USART_CR1_TE | USART_CR1_UE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Queue one frame.
+  * @note   Fragments shorter than CoalesceThreshold are copied into the
+  *         bounce ring and merged with their small neighbours; when the ring
+  *         is full they are sent in place instead. Longer fragments are split
+  *         at USARTTX_SEGMENT_MAX bytes.
+  * @param  htx transmit queue handle
+  * @param  Iov fragment array
+  * @param  Count number of fragments
+  * @retval SUCCESS, or ERROR when the frame is empty, does not fit in the
+  *         segment ring or the queue stopped on a DMA error
+  */
+ErrorStatus USARTTX_Send(USARTTX_HandleTypeDef *htx, const USARTTX_IovecTypeDef *Iov, uint32_t Count)
+{
+  uint32_t segMask = htx->NbSegments - 1UL;
+  uint32_t bounceMask = htx->BounceSize - 1UL;
+  uint32_t head = htx->SegHead;
+  uint32_t segFree = htx->NbSegments - (head - htx->SegTail);
+  uint32_t bh = htx->BounceHead;
+  uint32_t bounceUsed = bh - htx->BounceTail;
+  uint32_t coalesced = 0UL;
+  USARTTX_SegmentTypeDef *open = NULL;
+  USARTTX_SegmentTypeDef *seg = NULL;
+  const uint8_t *data;
+  uint32_t length;
+  uint32_t offset;
+  uint32_t pad;
+  uint32_t chunk;
+  uint32_t i;
+  uint32_t j;
+  uint32_t primask;
+
+  if (htx->Failed != 0UL)
+  {
+    htx->Stats.Rejected++;
+    return ERROR;
+  }
+
+  for (i = 0UL; i < Count; i++)
+  {
+    data = Iov[i].Data;
+    length = Iov[i].Length;
+    if (length == 0UL)
+    {
+      continue;
+    }
+
+    if ((htx->Bounce != NULL) && (length < htx->CoalesceThreshold))
+    {
+      offset = bh & bounceMask;
+
+      /* Append to the bounce segment opened by the previous fragment, as
+         long as the copy follows it: not once the ring has wrapped */
+      if ((open != NULL) && (&htx->Bounce[offset] == &open->Data[open->Length]) &&
+          ((offset + length) <= htx->BounceSize) &&
+          ((bounceUsed + length) <= htx->BounceSize) &&
+          (((uint32_t)open->Length + length) <= USARTTX_SEGMENT_MAX))
+      {
+        for (j = 0UL; j < length; j++)
+        {
+          htx->Bounce[offset + j] = data[j];
+        }
+        open->Length += (uint16_t)length;
+        open->Bounce += length;
+        bh += length;
+        bounceUsed += length;
+        coalesced += length;
+        continue;
+      }
+
+      /* Open a new bounce segment, skipping the end of the ring if needed */
+      pad = ((offset + length) > htx->BounceSize) ? (htx->BounceSize - offset) : 0UL;
+      if ((segFree != 0UL) && ((bounceUsed + pad + length) <= htx->BounceSize))
+      {
+        offset = (offset + pad) & bounceMask;
+        for (j = 0UL; j < length; j++)
+        {
+          htx->Bounce[offset + j] = data[j];
+        }
+        seg = &htx->Segments[head & segMask];
+        seg->Data = &htx->Bounce[offset];
+        seg->Length = (uint16_t)length;
+        seg->Flags = 0U;
+        seg->Bounce = pad + length;
+        head++;
+        segFree--;
+        bh += pad + length;
+        bounceUsed += pad + length;
+        coalesced += length;
+        open = seg;
+        continue;
+      }
+      /* No bounce room: send in place */
+    }
+
+    open = NULL;
+    while (length != 0UL)
+    {
+      if (segFree == 0UL)
+      {
+        htx->Stats.Rejected++;
+        return ERROR;
+      }
+      chunk = (length < USARTTX_SEGMENT_MAX) ? length : USARTTX_SEGMENT_MAX;
+      seg = &htx->Segments[head & segMask];
+      seg->Data = data;
+      seg->Length = (uint16_t)chunk;
+      seg->Flags = 0U;
+      seg->Bounce = 0UL;
+      head++;
+      segFree--;
+      data += chunk;
+      length -= chunk;
+    }
+  }
+
+  if (seg == NULL)
+  {
+    htx->Stats.Rejected++;
+    return ERROR;
+  }
+  seg->Flags |= USARTTX_SEG_END_OF_FRAME;
+
+  /* Publish, then restart the channel if the interrupt found it empty */
+  htx->Stats.Fragments += Count;
+  htx->Stats.CoalescedBytes += coalesced;
+  htx->BounceHead = bh;
+  htx->SegHead = head;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((htx->Busy == 0UL) && (htx->Failed == 0UL))
+  {
+    htx->Busy = 1UL;
+    USARTTX_Load(htx, &htx->Segments[htx->SegTail & segMask]);
+  }
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Tell whether every queued frame was handed to the USART.
+  * @param  htx transmit queue handle
+  * @retval 1 when idle, 0 otherwise
+  */
+uint32_t USARTTX_IsIdle(const USARTTX_HandleTypeDef *htx)
+{
+  return ((htx->Busy == 0UL) && (htx->SegHead == htx->SegTail)) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Handle the DMA channel interrupt.
+  * @param  htx transmit queue handle
+  * @retval None
+  */
+void USARTTX_IRQHandler(USARTTX_HandleTypeDef *htx)
+{
+  uint32_t flags = DMA_UTIL_GetFlags(htx->Channel);
+
+  if ((flags & (DMA_UTIL_FLAG_TC | DMA_UTIL_FLAG_TE)) != 0UL)
+  {
+    DMA_UTIL_ClearFlags(htx->Channel, flags);
+    USARTTX_FlagsHandler(htx, flags);
+  }
+}
+
+/**
+  * @brief  Process channel flags already read and cleared by the caller.
+  * @note   Signature matches DMAIRQ_HandlerTypeDef.
+  * @param  Context transmit queue handle
+  * @param  Flags combination of DMA_UTIL_FLAG_xx
+  * @retval None
+  */
+void USARTTX_FlagsHandler(void *Context, uint32_t Flags)
+{
+  USARTTX_HandleTypeDef *htx = (USARTTX_HandleTypeDef *)Context;
+  uint32_t segMask = htx->NbSegments - 1UL;
+  const USARTTX_SegmentTypeDef *done;
+  uint32_t tail;
+  uint32_t frames;
+
+  htx->Stats.Interrupts++;
+
+  if ((Flags & DMA_UTIL_FLAG_TE) != 0UL)
+  {
+    htx->Channel->CCR = 0UL;
+    htx->Busy = 0UL;
+    htx->Failed = 1UL;
+    htx->Stats.Errors++;
+    return;
+  }
+  if ((Flags & DMA_UTIL_FLAG_TC) == 0UL)
+  {
+    return;
+  }
+
+  /* Keep the USART fed: reload before any bookkeeping */
+  tail = htx->SegTail;
+  done = &htx->Segments[tail & segMask];
+  tail++;
+  if (tail != htx->SegHead)
+  {
+    USARTTX_Load(htx, &htx->Segments[tail & segMask]);
+  }
+  else
+  {
+    htx->Channel->CCR = USARTTX_CCR;
+    htx->Busy = 0UL;
+  }
+
+  htx->BounceTail += done->Bounce;
+  htx->Stats.Segments++;
+  if ((done->Flags & USARTTX_SEG_END_OF_FRAME) != 0U)
+  {
+    htx->PendingFrames++;
+    htx->Stats.Frames++;
+  }
+  htx->SegTail = tail;
+
+  frames = htx->PendingFrames;
+  if ((frames != 0UL) &&
+      ((htx->Busy == 0UL) || ((htx->BatchFrames != 0UL) && (frames >= htx->BatchFrames))))
+  {
+    htx->PendingFrames = 0UL;
+    htx->Stats.Callbacks++;
+    if (htx->CompleteCallback != NULL)
+    {
+      htx->CompleteCallback(htx, frames);
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/
@@ -0,0 +1,322 @@
+/**
+  ******************************************************************************
+  * @file    stm32g0xx_usart_fifo.c
+  * @author  cmsis_device_g0 contributors
+  * @brief   CMSIS STM32G0xx USART FIFO mode driver.
+  *
+  *   This file provides:
+  *      - USARTFIFO_Init(): enables the FIFOs and programs the per link
+  *                          receive and transmit thresholds.
+  *
+  *      - USARTFIFO_Write() / USARTFIFO_Read(): non blocking access to the
+  *                          software rings, from thread context.
+  *
+  *      - USARTFIFO_IRQHandler(): must be called from the USART vector. It
+  *                                moves up to USARTFIFO_DEPTH bytes per
+  *                                direction per interrupt.
+  *
+  *   Each software ring has a single producer and a single consumer, so no
+  *   interrupt masking is needed on the data path; only the TXFTIE enable
+  *   bit is shared between thread and interrupt context.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2026 cmsis_device_g0 contributors.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+
+/** @addtogroup CMSIS
+  * @{
+  */
+
+/** @addtogroup stm32g0xx_usart_fifo
+  * @{
+  */
+
+/** @addtogroup STM32G0xx_USART_FIFO_Private_Includes
+  * @{
+  */
+
+#include "stm32g0xx_usart_fifo.h"
+#include <stddef.h>
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_FIFO_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Tell whether a ring size is a non zero power of two.
+  * @param  Size ring size
+  * @retval 1 when valid, 0 otherwise
+  */
+static uint32_t USARTFIFO_IsPow2(uint32_t Size)
+{
+  return ((Size != 0UL) && ((Size & (Size - 1UL)) == 0UL)) ? 1UL : 0UL;
+}
+
+/**
+  * @brief  Tell whether an instance is a low-power UART.
+  * @param  Instance USART or LPUART instance
+  * @retval 1 for LPUART instances, 0 otherwise
+  */
+static uint32_t USARTFIFO_IsLpuart(const USART_TypeDef *Instance)
+{
+#if defined(LPUART2)
+  if (Instance == LPUART2)
+  {
+    return 1UL;
+  }
+#endif /* LPUART2 */
+#if defined(LPUART1)
+  if (Instance == LPUART1)
+  {
+    return 1UL;
+  }
+#else
+  (void)Instance;
+#endif /* LPUART1 */
+  return 0UL;
+}
+
+/**
+  * @brief  Enable the transmit threshold interrupt.
+  * @param  hfifo FIFO driver handle
+  * @retval None
+  */
+static void USARTFIFO_EnableTx(USARTFIFO_HandleTypeDef *hfifo)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  SET_BIT(hfifo->Instance->CR3, USART_CR3_TXFTIE);
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup STM32G0xx_USART_FIFO_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  Initialize the FIFO driver and enable the USART.
+  * @param  hfifo FIFO driver handle
+  * @retval SUCCESS or ERROR on an invalid configuration or an instance
+  *         without FIFOs
+  */
+ErrorStatus USARTFIFO_Init(USARTFIFO_HandleTypeDef *hfifo)
+{
+  USART_TypeDef *usart;
+  uint32_t cr1;
+
+  if ((hfifo == NULL) || (IS_UART_FIFO_INSTANCE(hfifo->Instance) == 0) ||
+      (hfifo->RxBuffer == NULL) || (USARTFIFO_IsPow2(hfifo->RxSize) == 0UL) ||
+      (hfifo->TxBuffer == NULL) || (USARTFIFO_IsPow2(hfifo->TxSize) == 0UL) ||
+      (hfifo->RxThreshold > USARTFIFO_THRESHOLD_8_8) || (hfifo->TxThreshold > USARTFIFO_THRESHOLD_8_8))
+  {
+    return ERROR;
+  }
+  if ((hfifo->Framing == USARTFIFO_FRAMING_TIMEOUT) &&
+      ((USARTFIFO_IsLpuart(hfifo->Instance) != 0UL) || (hfifo->TimeoutBits > USART_RTOR_RTO)))
+  {
+    return ERROR;
+  }
+
+  usart = hfifo->Instance;
+  hfifo->RxHead = 0UL;
+  hfifo->RxTail = 0UL;
+  hfifo->TxHead = 0UL;
+  hfifo->TxTail = 0UL;
+  hfifo->Stats.Interrupts = 0UL;
+  hfifo->Stats.RxBytes = 0UL;
+  hfifo->Stats.TxBytes = 0UL;
+  hfifo->Stats.RxDropped = 0UL;
+  hfifo->Stats.Overruns = 0UL;
+
+  CLEAR_BIT(usart->CR1, USART_CR1_UE);
+
+  MODIFY_REG(usart->CR3, USART_CR3_RXFTCFG | USART_CR3_TXFTCFG | USART_CR3_TXFTIE,
+             (hfifo->RxThreshold << USART_CR3_RXFTCFG_Pos) | (hfifo->TxThreshold << USART_CR3_TXFTCFG_Pos) |
+             USART_CR3_RXFTIE | USART_CR3_EIE);
+
+  cr1 = USART_CR1_FIFOEN | USART_CR1_TE | USART_CR1_RE;
+  if (hfifo->Framing == USARTFIFO_FRAMING_TIMEOUT)
+  {
+    usart->RTOR = (usart->RTOR & ~USART_RTOR_RTO) | hfifo->TimeoutBits;
+    SET_BIT(usart->CR2, USART_CR2_RTOEN);
+    cr1 |= USART_CR1_RTOIE;
+  }
+  else
+  {
+    if (USARTFIFO_IsLpuart(usart) == 0UL)
+    {
+      CLEAR_BIT(usart->CR2, USART_CR2_RTOEN);
+    }
+    cr1 |= USART_CR1_IDLEIE;
+  }
+  MODIFY_REG(usart->CR1, USART_CR1_RXNEIE_RXFNEIE | USART_CR1_TXEIE_TXFNFIE | USART_CR1_RTOIE | USART_CR1_IDLEIE,
+             cr1);
+
+  SET_BIT(usart->CR1, USART_CR1_UE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Queue bytes for transmission.
+  * @param  hfifo FIFO driver handle
+  * @param  Data bytes to send
+  * @param  Length number of bytes
+  * @retval Number of bytes queued, lower than Length when the ring is full
+  */
+uint32_t USARTFIFO_Write(USARTFIFO_HandleTypeDef *hfifo, const uint8_t *Data, uint32_t Length)
+{
+  uint32_t mask = hfifo->TxSize - 1UL;
+  uint32_t head = hfifo->TxHead;
+  uint32_t space = hfifo->TxSize - (head - hfifo->TxTail);
+  uint32_t count = (Length < space) ? Length : space;
+  uint32_t i;
+
+  for (i = 0UL; i < count; i++)
+  {
+    hfifo->TxBuffer[(head + i) & mask] = Data[i];
+  }
+  hfifo->TxHead = head + count;
+
+  if (count != 0UL)
+  {
+    USARTFIFO_EnableTx(hfifo);
+  }
+  return count;
+}
+
+/**
+  * @brief  Fetch received bytes.
+  * @param  hfifo FIFO driver handle
+  * @param  Data destination
+  * @param  Length maximum number of bytes
+  * @retval Number of bytes copied
+  */
+uint32_t USARTFIFO_Read(USARTFIFO_HandleTypeDef *hfifo, uint8_t *Data, uint32_t Length)
+{
+  uint32_t mask = hfifo->RxSize - 1UL;
+  uint32_t tail = hfifo->RxTail;
+  uint32_t avail = hfifo->RxHead - tail;
+  uint32_t count = (Length < avail) ? Length : avail;
+  uint32_t i;
+
+  for (i = 0UL; i < count; i++)
+  {
+    Data[i] = hfifo->RxBuffer[(tail + i) & mask];
+  }
+  hfifo->RxTail = tail + count;
+
+  return count;
+}
+
+/**
+  * @brief  Number of received bytes waiting in the software ring.
+  * @param  hfifo FIFO driver handle
+  * @retval Byte count
+  */
+uint32_t USARTFIFO_GetRxCount(const USARTFIFO_HandleTypeDef *hfifo)
+{
+  return hfifo->RxHead - hfifo->RxTail;
+}
+
+/**
+  * @brief  Handle the USART interrupt.
+  * @param  hfifo FIFO driver handle
+  * @retval None
+  */
+void USARTFIFO_IRQHandler(USARTFIFO_HandleTypeDef *hfifo)
+{
+  USART_TypeDef *usart = hfifo->Instance;
+  uint32_t isr = usart->ISR;
+  uint32_t mask;
+  uint32_t head;
+  uint32_t tail;
+  uint8_t data;
+
+  hfifo->Stats.Interrupts++;
+
+  if ((isr & (USART_ISR_ORE | USART_ISR_FE | USART_ISR_NE | USART_ISR_PE)) != 0UL)
+  {
+    usart->ICR = USART_ICR_ORECF | USART_ICR_FECF | USART_ICR_NECF | USART_ICR_PECF;
+    if ((isr & USART_ISR_ORE) != 0UL)
+    {
+      hfifo->Stats.Overruns++;
+    }
+  }
+
+  /* Receive: drain the whole FIFO on threshold or end of burst */
+  if ((isr & (USART_ISR_RXFT | USART_ISR_RTOF | USART_ISR_IDLE | USART_ISR_RXNE_RXFNE)) != 0UL)
+  {
+    usart->ICR = USART_ICR_RTOCF | USART_ICR_IDLECF;
+    mask = hfifo->RxSize - 1UL;
+    head = hfifo->RxHead;
+    tail = hfifo->RxTail;
+    while ((usart->ISR & USART_ISR_RXNE_RXFNE) != 0UL)
+    {
+      data = (uint8_t)usart->RDR;
+      if ((head - tail) < hfifo->RxSize)
+      {
+        hfifo->RxBuffer[head & mask] = data;
+        head++;
+        hfifo->Stats.RxBytes++;
+      }
+      else
+      {
+        hfifo->Stats.RxDropped++;
+      }
+    }
+    hfifo->RxHead = head;
+  }
+
+  /* Transmit: refill the FIFO up to full */
+  if (((usart->CR3 & USART_CR3_TXFTIE) != 0UL) && ((isr & USART_ISR_TXFT) != 0UL))
+  {
+    mask = hfifo->TxSize - 1UL;
+    head = hfifo->TxHead;
+    tail = hfifo->TxTail;
+    while ((tail != head) && ((usart->ISR & USART_ISR_TXE_TXFNF) != 0UL))
+    {
+      usart->TDR = hfifo->TxBuffer[tail & mask];
+      tail++;
+      hfifo->Stats.TxBytes++;
+    }
+    hfifo->TxTail = tail;
+    if (tail == head)
+    {
+      CLEAR_BIT(usart->CR3, USART_CR3_TXFTIE);
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT cmsis_device_g0 contributors *****END OF FILE****/